@@ -17,12 +17,22 @@
 #include <daw/daw_character_traits.h>
 #include <daw/daw_string_view.h>
 
+#include <cstddef>
 #include <cstdio>
 #include <iostream>
+#include <iterator>
 #include <string>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief A writable output that only counts the characters written to
+			/// it
+			struct size_counting_output {
+				std::size_t size = 0;
+			};
+		} // namespace json_details
+
 		namespace concepts {
 			namespace writeable_output_details {
 				template<typename T>
@@ -287,6 +297,24 @@ namespace daw::json {
 					++it;
 				}
 			};
+
+			/// @brief Specialization for size_counting_output
+			template<>
+			struct writable_output_trait<json_details::size_counting_output>
+			  : std::true_type {
+
+				template<typename... StringViews>
+				static constexpr void write( json_details::size_counting_output &out,
+				                             StringViews const &...svs ) {
+					static_assert( sizeof...( StringViews ) > 0 );
+					out.size += ( std::size( svs ) + ... );
+				}
+
+				static constexpr void put( json_details::size_counting_output &out,
+				                           char ) {
+					++out.size;
+				}
+			};
 		} // namespace concepts
 	}   // namespace DAW_JSON_VER
 } // namespace daw::json
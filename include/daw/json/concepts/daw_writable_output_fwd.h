@@ -10,8 +10,11 @@
 
 #include "../impl/version.h"
 
+#include <daw/daw_string_view.h>
 #include <daw/daw_traits.h>
 
+#include <utility>
+
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
 		namespace concepts {
@@ -27,6 +30,19 @@ namespace daw::json {
 			template<typename T>
 			inline constexpr bool is_writable_output_type_v =
 			  writable_output_trait<T>::value;
+
+			template<typename T>
+			using writable_output_reference_test =
+			  decltype( writable_output_trait<T>::write_reference(
+			    std::declval<T &>( ), std::declval<daw::string_view>( ) ) );
+
+			/// @brief Specializations may have a static void write_reference( T &,
+			/// daw::string_view ).  It is used for the data of string members, which
+			/// outlives the serialization, so that the output can keep a reference
+			/// to it instead of copying
+			template<typename T>
+			inline constexpr bool has_writable_output_reference_v =
+			  daw::is_detected_v<writable_output_reference_test, T>;
 		} // namespace concepts
 
 		template<typename WritableOutput, typename... StringViews>
@@ -0,0 +1,246 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_json_exception.h"
+#include "impl/daw_json_assert.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief A monotonic bump allocator.  Memory is taken from chunks that
+		/// grow geometrically and is only given back by reset( ) or when the arena
+		/// is destroyed.  Values allocated from the arena must not outlive the
+		/// next reset( ).  It is not thread safe.
+		class json_arena {
+			struct chunk_header {
+				chunk_header *next;
+				std::size_t size;
+			};
+
+			chunk_header *m_chunks = nullptr;
+			unsigned char *m_ptr = nullptr;
+			unsigned char *m_end = nullptr;
+			std::size_t m_next_chunk_size;
+			std::size_t m_used = 0;
+
+			[[nodiscard]] static unsigned char *chunk_data( chunk_header *c ) {
+				return reinterpret_cast<unsigned char *>( c + 1 );
+			}
+
+			void add_chunk( std::size_t min_size ) {
+				std::size_t size = m_next_chunk_size;
+				while( size < min_size ) {
+					size *= 2U;
+				}
+				auto *c = static_cast<chunk_header *>(
+				  ::operator new( sizeof( chunk_header ) + size ) );
+				c->next = m_chunks;
+				c->size = size;
+				m_chunks = c;
+				m_ptr = chunk_data( c );
+				m_end = m_ptr + size;
+				m_next_chunk_size = size * 2U;
+			}
+
+			void free_chunks( chunk_header *c ) noexcept {
+				while( c != nullptr ) {
+					auto *next = c->next;
+					::operator delete( c );
+					c = next;
+				}
+			}
+
+		public:
+			static constexpr std::size_t default_chunk_size = 64U * 1024U;
+
+			/// @param initial_chunk_size Size of the first chunk.  Each following
+			/// chunk is twice the size of the previous
+			explicit json_arena(
+			  std::size_t initial_chunk_size = default_chunk_size )
+			  : m_next_chunk_size( initial_chunk_size > 0 ? initial_chunk_size
+			                                              : default_chunk_size ) {}
+
+			json_arena( json_arena const & ) = delete;
+			json_arena( json_arena && ) = delete;
+			json_arena &operator=( json_arena const & ) = delete;
+			json_arena &operator=( json_arena && ) = delete;
+
+			~json_arena( ) {
+				free_chunks( m_chunks );
+			}
+
+			/// @brief Allocate size bytes aligned to alignment
+			[[nodiscard]] void *allocate( std::size_t size, std::size_t alignment ) {
+				auto const misalign =
+				  reinterpret_cast<std::uintptr_t>( m_ptr ) & ( alignment - 1U );
+				std::size_t const pad = misalign == 0 ? 0 : alignment - misalign;
+				if( m_ptr == nullptr or
+				    static_cast<std::size_t>( m_end - m_ptr ) < size + pad ) {
+					add_chunk( size + alignment );
+					return allocate( size, alignment );
+				}
+				auto *result = m_ptr + pad;
+				m_ptr = result + size;
+				m_used += size + pad;
+				return result;
+			}
+
+			/// @brief Make all the memory available again.  The largest chunk is
+			/// kept so that parsing documents of a similar size does not allocate
+			/// after the first time
+			void reset( ) noexcept {
+				if( m_chunks == nullptr ) {
+					return;
+				}
+				// The newest chunk is the largest
+				free_chunks( m_chunks->next );
+				m_chunks->next = nullptr;
+				m_ptr = chunk_data( m_chunks );
+				m_end = m_ptr + m_chunks->size;
+				m_used = 0;
+			}
+
+			/// @brief Free all chunks
+			void release( ) noexcept {
+				free_chunks( m_chunks );
+				m_chunks = nullptr;
+				m_ptr = nullptr;
+				m_end = nullptr;
+				m_used = 0;
+			}
+
+			/// @brief Bytes handed out since the last reset, including alignment
+			[[nodiscard]] std::size_t used( ) const {
+				return m_used;
+			}
+
+			/// @brief Bytes held in chunks
+			[[nodiscard]] std::size_t capacity( ) const {
+				std::size_t result = 0;
+				for( auto const *c = m_chunks; c != nullptr; c = c->next ) {
+					result += c->size;
+				}
+				return result;
+			}
+		};
+
+		/// @brief A standard allocator that takes its memory from a json_arena.
+		/// deallocate does nothing
+		template<typename T>
+		class json_arena_allocator {
+			json_arena *m_arena = nullptr;
+
+			template<typename>
+			friend class json_arena_allocator;
+
+		public:
+			using value_type = T;
+			using propagate_on_container_copy_assignment = std::true_type;
+			using propagate_on_container_move_assignment = std::true_type;
+			using propagate_on_container_swap = std::true_type;
+
+			/// @brief An allocator without an arena.  It must be assigned one before
+			/// allocating
+			constexpr json_arena_allocator( ) noexcept = default;
+
+			constexpr json_arena_allocator( json_arena &arena ) noexcept
+			  : m_arena( &arena ) {}
+
+			template<typename U>
+			constexpr json_arena_allocator(
+			  json_arena_allocator<U> const &other ) noexcept
+			  : m_arena( other.m_arena ) {}
+
+			[[nodiscard]] T *allocate( std::size_t n ) {
+				daw_json_ensure( m_arena != nullptr, ErrorReason::UnexpectedNull );
+				if( n > std::numeric_limits<std::size_t>::max( ) / sizeof( T ) ) {
+#if defined( DAW_USE_EXCEPTIONS )
+					throw std::bad_array_new_length( );
+#else
+					std::terminate( );
+#endif
+				}
+				return static_cast<T *>(
+				  m_arena->allocate( n * sizeof( T ), alignof( T ) ) );
+			}
+
+			constexpr void deallocate( T *, std::size_t ) noexcept {}
+
+			[[nodiscard]] constexpr json_arena &arena( ) const noexcept {
+				return *m_arena;
+			}
+
+			template<typename U>
+			[[nodiscard]] constexpr bool
+			operator==( json_arena_allocator<U> const &rhs ) const noexcept {
+				return m_arena == rhs.m_arena;
+			}
+
+			template<typename U>
+			[[nodiscard]] constexpr bool
+			operator!=( json_arena_allocator<U> const &rhs ) const noexcept {
+				return m_arena != rhs.m_arena;
+			}
+		};
+
+		/// @brief A string that allocates from a json_arena
+		using json_arena_string = std::basic_string<char, std::char_traits<char>,
+		                                            json_arena_allocator<char>>;
+
+		/// @brief A vector that allocates from a json_arena
+		template<typename T>
+		using json_arena_vector = std::vector<T, json_arena_allocator<T>>;
+
+		/// @brief Parse a JsonElement with every allocator aware member, such as
+		/// json_arena_string and json_arena_vector, allocating from arena.  Members
+		/// that are not allocator aware are constructed as usual.  The result must
+		/// not be used after arena is reset or destroyed
+		/// @tparam JsonElement Type to parse the document as
+		/// @param json_data JSON string data
+		/// @param arena The arena to allocate from
+		/// @return A reified JsonElement constructed from JSON data
+		/// @throws daw::json::json_exception
+		template<typename JsonElement, typename String, auto... PolicyFlags>
+		[[nodiscard]] auto
+		from_json_arena( String &&json_data, json_arena &arena,
+		                 options::parse_flags_t<PolicyFlags...> flags ) {
+			return from_json_alloc<JsonElement>(
+			  DAW_FWD( json_data ), json_arena_allocator<char>( arena ), flags );
+		}
+
+		/// @brief Parse a JsonElement with every allocator aware member, such as
+		/// json_arena_string and json_arena_vector, allocating from arena.  Members
+		/// that are not allocator aware are constructed as usual.  The result must
+		/// not be used after arena is reset or destroyed
+		/// @tparam JsonElement Type to parse the document as
+		/// @param json_data JSON string data
+		/// @param arena The arena to allocate from
+		/// @return A reified JsonElement constructed from JSON data
+		/// @throws daw::json::json_exception
+		template<typename JsonElement, typename String>
+		[[nodiscard]] auto from_json_arena( String &&json_data,
+		                                    json_arena &arena ) {
+			return from_json_alloc<JsonElement>(
+			  DAW_FWD( json_data ), json_arena_allocator<char>( arena ),
+			  options::parse_flags<> );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,172 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "concepts/daw_writable_output.h"
+#include "daw_json_exception.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief A writable output that collects the output in an N byte buffer
+		/// and passes it on to Sink in blocks of up to N bytes.  Serializing to a
+		/// FILE * or std::ostream directly makes a call, with its locking and error
+		/// checks, for every small piece of the document.  The buffer is flushed
+		/// when it fills, when flush( ) is called and on destruction.
+		/// @tparam Sink A writable output, such as std::FILE * or std::ostream.
+		/// Pointer sinks are held by value and the others by reference
+		/// @tparam N Size of the buffer held inside the object
+		template<typename Sink, std::size_t N = 4096>
+		class buffered_output {
+			static_assert( N > 0, "The buffer must not be empty" );
+			static_assert( concepts::is_writable_output_type_v<Sink>,
+			               "Sink does not have a writable_output_trait "
+			               "specialization" );
+
+			using sink_storage_t =
+			  std::conditional_t<std::is_pointer_v<Sink>, Sink, Sink *>;
+
+			sink_storage_t m_sink;
+			std::size_t m_size = 0;
+			char m_buffer[N];
+
+			[[nodiscard]] Sink &sink( ) {
+				if constexpr( std::is_pointer_v<Sink> ) {
+					return m_sink;
+				} else {
+					return *m_sink;
+				}
+			}
+
+			void write_one( daw::string_view sv ) {
+				if( sv.size( ) > N - m_size ) {
+					flush( );
+					if( sv.size( ) >= N ) {
+						write_output( sink( ), sv );
+						return;
+					}
+				}
+				std::memcpy( m_buffer + m_size, sv.data( ), sv.size( ) );
+				m_size += sv.size( );
+			}
+
+		public:
+			static constexpr std::size_t buffer_size = N;
+
+			/// @param sink Output to flush to.  It must outlive this object unless
+			/// it is a pointer
+			explicit buffered_output(
+			  std::conditional_t<std::is_pointer_v<Sink>, Sink, Sink &> sink )
+			  : m_sink( [&] {
+				  if constexpr( std::is_pointer_v<Sink> ) {
+					  return sink;
+				  } else {
+					  return std::addressof( sink );
+				  }
+			  }( ) ) {
+				if constexpr( std::is_pointer_v<Sink> ) {
+					daw_json_ensure( m_sink != nullptr,
+					                 ErrorReason::NullOutputIterator );
+				}
+			}
+
+			buffered_output( buffered_output const & ) = delete;
+			buffered_output &operator=( buffered_output const & ) = delete;
+
+			/// @brief Take over the sink and any output not yet flushed
+			buffered_output( buffered_output &&other ) noexcept
+			  : m_sink( other.m_sink )
+			  , m_size( other.m_size ) {
+				std::memcpy( m_buffer, other.m_buffer, m_size );
+				other.m_size = 0;
+			}
+
+			buffered_output &operator=( buffered_output && ) = delete;
+
+			/// @brief Flush the remaining output.  Errors are not reported from
+			/// here, call flush( ) first to see them
+			~buffered_output( ) {
+#if defined( DAW_USE_EXCEPTIONS )
+				try {
+					flush( );
+				} catch( ... ) {}
+#else
+				flush( );
+#endif
+			}
+
+			/// @brief Pass all buffered output to the sink
+			/// @throws daw::json::json_exception with ErrorReason::OutputError when
+			/// the sink fails
+			void flush( ) {
+				if( m_size == 0 ) {
+					return;
+				}
+				auto const size = m_size;
+				m_size = 0;
+				write_output( sink( ), daw::string_view( m_buffer, size ) );
+			}
+
+			template<typename... StringViews>
+			void write( StringViews const &...svs ) {
+				( write_one( daw::string_view( svs ) ), ... );
+			}
+
+			void put( char c ) {
+				if( m_size == N ) {
+					flush( );
+				}
+				m_buffer[m_size] = c;
+				++m_size;
+			}
+
+			/// @brief The number of bytes waiting to be flushed
+			[[nodiscard]] std::size_t size( ) const {
+				return m_size;
+			}
+		};
+
+		buffered_output( std::FILE * )->buffered_output<std::FILE *>;
+
+		template<typename T,
+		         std::enable_if_t<std::is_base_of_v<std::ostream, T>,
+		                          std::nullptr_t> = nullptr>
+		buffered_output( T & )->buffered_output<T>;
+
+		namespace concepts {
+			/// @brief Specialization for buffered_output
+			template<typename Sink, std::size_t N>
+			struct writable_output_trait<buffered_output<Sink, N>>
+			  : std::true_type {
+
+				template<typename... StringViews>
+				static inline void write( buffered_output<Sink, N> &out,
+				                          StringViews const &...svs ) {
+					static_assert( sizeof...( StringViews ) > 0 );
+					out.write( svs... );
+				}
+
+				static inline void put( buffered_output<Sink, N> &out, char c ) {
+					out.put( c );
+				}
+			};
+		} // namespace concepts
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,424 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_exception.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_parse_name.h"
+#include "impl/daw_json_skip.h"
+#include "impl/daw_json_value.h"
+#include "impl/daw_murmur3.h"
+
+#include <daw/daw_string_view.h>
+#include <daw/daw_uint_buffer.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		template<json_options_t PolicyFlags = json_details::default_policy_flag,
+		         typename Allocator = json_details::NoAllocator>
+		class basic_json_document_index;
+
+		namespace json_details {
+			/// @brief One value in a basic_json_document_index.  Offsets are from
+			/// the start of the document and nodes are numbered in document order, so
+			/// the children of a node follow it.
+			struct json_index_node {
+				static constexpr std::uint32_t npos =
+				  ( std::numeric_limits<std::uint32_t>::max )( );
+
+				/// Offset of the first character of the value
+				std::uint32_t first = 0;
+				/// Offset one past the last character of the value
+				std::uint32_t last = 0;
+				/// Offset of the member name, inside the quotes
+				std::uint32_t name_first = 0;
+				std::uint32_t name_size = 0;
+				daw::UInt32 name_hash = daw::UInt32( );
+				std::uint32_t parent = npos;
+				std::uint32_t next_sibling = npos;
+				/// Position in the child table of the first child of a class or array
+				std::uint32_t children_first = 0;
+				std::uint32_t child_count = 0;
+				JsonBaseParseTypes type = JsonBaseParseTypes::None;
+				bool has_name = false;
+			};
+		} // namespace json_details
+
+		/// @brief A handle to a value in a basic_json_document_index.  Moving to a
+		/// member, element, parent or sibling uses the index and not the JSON
+		/// document.  It is only valid while the index is.
+		template<json_options_t PolicyFlags = json_details::default_policy_flag,
+		         typename Allocator = json_details::NoAllocator>
+		class basic_json_index_value {
+			using index_t = basic_json_document_index<PolicyFlags, Allocator>;
+			using node_t = json_details::json_index_node;
+			using ParseState =
+			  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags, Allocator>>;
+
+			index_t const *m_index = nullptr;
+			std::uint32_t m_node = node_t::npos;
+
+			[[nodiscard]] node_t const &node( ) const {
+				return m_index->m_nodes[m_node];
+			}
+
+			[[nodiscard]] basic_json_index_value at_node( std::uint32_t n ) const {
+				if( n == node_t::npos ) {
+					return basic_json_index_value( );
+				}
+				return basic_json_index_value( *m_index, n );
+			}
+
+		public:
+			basic_json_index_value( ) = default;
+
+			explicit basic_json_index_value( index_t const &index,
+			                                 std::uint32_t node_id )
+			  : m_index( &index )
+			  , m_node( node_id ) {}
+
+			/// @brief Is this a value in the index
+			[[nodiscard]] explicit operator bool( ) const {
+				return m_index != nullptr and m_node != node_t::npos;
+			}
+
+			/// @brief The JSON type of the value
+			[[nodiscard]] JsonBaseParseTypes type( ) const {
+				if( not *this ) {
+					return JsonBaseParseTypes::None;
+				}
+				return node( ).type;
+			}
+
+			/// @brief The member name, as it is in the document, when this value is
+			/// a class member
+			[[nodiscard]] std::optional<std::string_view> name( ) const {
+				if( not *this or not node( ).has_name ) {
+					return std::nullopt;
+				}
+				return std::string_view( m_index->m_document.data( ) +
+				                           node( ).name_first,
+				                         node( ).name_size );
+			}
+
+			/// @brief The number of members or elements of a class or array
+			[[nodiscard]] std::size_t size( ) const {
+				if( not *this ) {
+					return 0;
+				}
+				return node( ).child_count;
+			}
+
+			/// @brief The JSON text of the value, including the quotes of strings
+			[[nodiscard]] std::string_view get_raw_json( ) const {
+				if( not *this ) {
+					return { };
+				}
+				return std::string_view( m_index->m_document.data( ) + node( ).first,
+				                         node( ).last - node( ).first );
+			}
+
+			/// @brief A basic_json_value starting at this value
+			[[nodiscard]] basic_json_value<PolicyFlags, Allocator> value( ) const {
+				if( not *this ) {
+					return basic_json_value<PolicyFlags, Allocator>( );
+				}
+				auto const doc = m_index->m_document;
+				return basic_json_value<PolicyFlags, Allocator>(
+				  ParseState( doc.data( ) + node( ).first, daw::data_end( doc ) ) );
+			}
+
+			/// @brief Parse the value as a Result.  Parsing starts at the recorded
+			/// position of the value
+			template<typename Result>
+			[[nodiscard]] auto as( ) const {
+				return value( ).template as<Result>( );
+			}
+
+			/// @brief The member or element this value is in
+			[[nodiscard]] basic_json_index_value parent( ) const {
+				if( not *this ) {
+					return basic_json_index_value( );
+				}
+				return at_node( node( ).parent );
+			}
+
+			/// @brief The next member or element of the parent
+			[[nodiscard]] basic_json_index_value next_sibling( ) const {
+				if( not *this ) {
+					return basic_json_index_value( );
+				}
+				return at_node( node( ).next_sibling );
+			}
+
+			/// @brief Find the nth member/element of the current class or array in
+			/// constant time
+			/// @return The specified member/element or an empty value
+			[[nodiscard]] basic_json_index_value
+			find_element( std::size_t index ) const {
+				if( index >= size( ) ) {
+					return basic_json_index_value( );
+				}
+				return at_node(
+				  m_index->m_children[node( ).children_first + index] );
+			}
+
+			/// @brief Find the first member of the current class with a matching
+			/// name.  Names are compared by hash first and the document is not read
+			/// @return The member or an empty value
+			[[nodiscard]] basic_json_index_value
+			find_class_member( daw::string_view name ) const {
+				if( type( ) != JsonBaseParseTypes::Class ) {
+					return basic_json_index_value( );
+				}
+				auto const hash =
+				  daw::name_hash<ParseState::expect_long_strings>( name );
+				auto const *first =
+				  m_index->m_children.data( ) + node( ).children_first;
+				auto const *const last = first + node( ).child_count;
+				for( ; first != last; ++first ) {
+					auto const &child = m_index->m_nodes[*first];
+					if( child.name_hash == hash and
+					    daw::string_view( m_index->m_document.data( ) +
+					                        child.name_first,
+					                      child.name_size ) == name ) {
+						return at_node( *first );
+					}
+				}
+				return basic_json_index_value( );
+			}
+
+			/// @brief find a class member/array element as specified by the
+			/// json_path, as basic_json_value::find_member does
+			[[nodiscard]] basic_json_index_value
+			find_member( daw::string_view json_path ) const {
+				return json_details::find_json_path<PolicyFlags>( *this, json_path );
+			}
+
+			/// @brief Find a value by json_path
+			[[nodiscard]] basic_json_index_value
+			operator[]( daw::string_view json_path ) const {
+				return find_member( json_path );
+			}
+
+			/// @brief Find the nth member/element of the current class or array
+			[[nodiscard]] basic_json_index_value
+			operator[]( std::size_t index ) const {
+				return find_element( index );
+			}
+		};
+
+		/// @brief A structural index of a JSON document, built in one pass.  It
+		/// records where each value starts and ends, member names and their hashes,
+		/// and the parent, siblings and children of every value.  Use it when the
+		/// same document is queried many times, as a basic_json_value rescans the
+		/// document on every lookup.  The document must outlive the index and be
+		/// smaller than 4GiB.
+		template<json_options_t PolicyFlags, typename Allocator>
+		class basic_json_document_index {
+			using node_t = json_details::json_index_node;
+			using ParseState =
+			  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags, Allocator>>;
+
+			friend class basic_json_index_value<PolicyFlags, Allocator>;
+
+			daw::string_view m_document;
+			std::vector<node_t> m_nodes{ };
+			// The children of each class/array, contiguous per parent
+			std::vector<std::uint32_t> m_children{ };
+
+			struct open_container {
+				std::uint32_t node;
+				// Position in the pending children of the first child
+				std::size_t pending_first;
+				std::uint32_t last_child = node_t::npos;
+			};
+
+			[[nodiscard]] std::uint32_t offset_of( char const *ptr ) const {
+				return static_cast<std::uint32_t>( ptr - m_document.data( ) );
+			}
+
+			// Record the value at the front of parse_state and move past it.
+			// Classes and arrays are only opened, their contents follow
+			void add_value( ParseState &parse_state, daw::string_view name,
+			                bool has_name, std::vector<open_container> &stack,
+			                std::vector<std::uint32_t> &pending ) {
+				daw_json_ensure( parse_state.has_more( ),
+				                 ErrorReason::UnexpectedEndOfData, parse_state );
+				auto const id = static_cast<std::uint32_t>( m_nodes.size( ) );
+				auto &n = m_nodes.emplace_back( );
+				n.first = offset_of( parse_state.first );
+				if( has_name ) {
+					n.has_name = true;
+					n.name_first = offset_of( name.data( ) );
+					n.name_size = static_cast<std::uint32_t>( name.size( ) );
+					n.name_hash = daw::name_hash<ParseState::expect_long_strings>( name );
+				}
+				if( not stack.empty( ) ) {
+					auto &parent = stack.back( );
+					n.parent = parent.node;
+					if( parent.last_child != node_t::npos ) {
+						m_nodes[parent.last_child].next_sibling = id;
+					}
+					parent.last_child = id;
+					pending.push_back( id );
+				}
+				switch( parse_state.front( ) ) {
+				case '{':
+				case '[':
+					n.type = parse_state.front( ) == '{' ? JsonBaseParseTypes::Class
+					                                     : JsonBaseParseTypes::Array;
+					parse_state.remove_prefix( );
+					stack.push_back( open_container{ id, pending.size( ) } );
+					return;
+				case '"':
+					n.type = JsonBaseParseTypes::String;
+					(void)json_details::skip_string( parse_state );
+					n.last = offset_of( parse_state.first );
+					return;
+				case 't':
+					n.type = JsonBaseParseTypes::Bool;
+					n.last = offset_of( json_details::skip_true( parse_state ).last );
+					return;
+				case 'f':
+					n.type = JsonBaseParseTypes::Bool;
+					n.last = offset_of( json_details::skip_false( parse_state ).last );
+					return;
+				case 'n':
+					// skip_null requires data after the literal, a top level null has none
+					n.type = JsonBaseParseTypes::Null;
+					daw_json_ensure( parse_state.starts_with( "null" ),
+					                 ErrorReason::InvalidNull, parse_state );
+					parse_state.remove_prefix( 4 );
+					n.last = offset_of( parse_state.first );
+					parse_state.trim_left( );
+					daw_json_assert_weak( not parse_state.has_more( ) or
+					                        parse_state.is_at_token_after_value( ),
+					                      ErrorReason::InvalidEndOfValue, parse_state );
+					return;
+				case '-':
+				case '0':
+				case '1':
+				case '2':
+				case '3':
+				case '4':
+				case '5':
+				case '6':
+				case '7':
+				case '8':
+				case '9':
+					n.type = JsonBaseParseTypes::Number;
+					(void)json_details::skip_number( parse_state );
+					n.last = offset_of( parse_state.first );
+					return;
+				}
+				daw_json_error( ErrorReason::InvalidStartOfValue, parse_state );
+			}
+
+			void build( ) {
+				daw_json_ensure( m_document.size( ) < node_t::npos,
+				                 ErrorReason::InputError );
+				auto parse_state =
+				  ParseState( std::data( m_document ), daw::data_end( m_document ) );
+				parse_state.trim_left( );
+				daw_json_ensure( parse_state.has_more( ),
+				                 ErrorReason::EmptyJSONDocument );
+
+				auto stack = std::vector<open_container>( );
+				auto pending = std::vector<std::uint32_t>( );
+				add_value( parse_state, daw::string_view( ), false, stack, pending );
+				while( not stack.empty( ) ) {
+					parse_state.trim_left( );
+					daw_json_ensure( parse_state.has_more( ),
+					                 ErrorReason::UnexpectedEndOfData, parse_state );
+					auto &current = stack.back( );
+					bool const is_class =
+					  m_nodes[current.node].type == JsonBaseParseTypes::Class;
+					if( parse_state.front( ) == ( is_class ? '}' : ']' ) ) {
+						parse_state.remove_prefix( );
+						auto &n = m_nodes[current.node];
+						n.last = offset_of( parse_state.first );
+						n.children_first = static_cast<std::uint32_t>( m_children.size( ) );
+						n.child_count = static_cast<std::uint32_t>(
+						  pending.size( ) - current.pending_first );
+						m_children.insert(
+						  m_children.end( ),
+						  pending.begin( ) +
+						    static_cast<std::ptrdiff_t>( current.pending_first ),
+						  pending.end( ) );
+						pending.resize( current.pending_first );
+						stack.pop_back( );
+						continue;
+					}
+					if( current.last_child != node_t::npos ) {
+						daw_json_ensure( parse_state.front( ) == ',',
+						                 ErrorReason::ExpectedTokenNotFound, parse_state );
+						parse_state.remove_prefix( );
+						parse_state.trim_left( );
+					}
+					if( is_class ) {
+						daw_json_ensure( parse_state.is_quotes_checked( ),
+						                 ErrorReason::InvalidMemberName, parse_state );
+						auto const name = json_details::parse_name( parse_state );
+						add_value( parse_state, name, true, stack, pending );
+					} else {
+						add_value( parse_state, daw::string_view( ), false, stack,
+						           pending );
+					}
+				}
+			}
+
+		public:
+			using value_type = basic_json_index_value<PolicyFlags, Allocator>;
+
+			/// @brief Index json_document.
+			/// @throws daw::json::json_exception when the document is not valid JSON
+			explicit basic_json_document_index( daw::string_view json_document )
+			  : m_document( json_document ) {
+				build( );
+			}
+
+			/// @brief The top level value of the document
+			[[nodiscard]] value_type root( ) const {
+				return value_type( *this, 0 );
+			}
+
+			/// @brief Find a value by json_path from the top level value
+			[[nodiscard]] value_type
+			operator[]( daw::string_view json_path ) const {
+				return root( ).find_member( json_path );
+			}
+
+			/// @brief The number of values in the document
+			[[nodiscard]] std::size_t size( ) const {
+				return m_nodes.size( );
+			}
+
+			/// @brief The indexed document
+			[[nodiscard]] daw::string_view document( ) const {
+				return m_document;
+			}
+		};
+
+		basic_json_document_index( daw::string_view )
+		  -> basic_json_document_index<>;
+
+		using json_document_index = basic_json_document_index<>;
+		using json_index_value = basic_json_index_value<>;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -111,7 +111,8 @@ namespace daw::json {
 			ExpectedTokenNotFound,
 			UnexpectedJSONVariantType,
 			TrailingComma,
-			AttemptToCallOpStarOnConstIterator
+			AttemptToCallOpStarOnConstIterator,
+			InputError
 		};
 
 		constexpr std::string_view reason_message( ErrorReason er ) {
@@ -213,6 +214,8 @@ namespace daw::json {
 				return "Trailing comma"sv;
 			case ErrorReason::AttemptToCallOpStarOnConstIterator:
 				return "Use of operator*( ) on const iterator";
+			case ErrorReason::InputError:
+				return "General error while reading input"sv;
 			}
 			DAW_UNREACHABLE( );
 		}
@@ -0,0 +1,207 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_json_lines_iterator.h"
+#include "impl/daw_json_cpu_features.h"
+#include "impl/daw_json_parse_options_impl.h"
+
+#include <daw/daw_move.h>
+#include <daw/daw_string_view.h>
+#include <daw/daw_traits.h>
+
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief Choose the fastest exec mode that was compiled in and that the
+			/// host supports.  Without SIMD support, the compile_time mode is used as
+			/// it is the fastest scalar mode
+			inline options::ExecModeTypes
+			select_exec_mode( cpu_features const &features ) {
+#if defined( DAW_ALLOW_AVX2 )
+#if defined( DAW_ALLOW_SSE42 )
+				// The AVX2 mode falls back to the SSE4.2 kernels where it has none
+				bool const has_avx2_fallbacks = features.sse42 and features.pclmul;
+#else
+				bool const has_avx2_fallbacks = true;
+#endif
+				if( features.avx2 and features.bmi1 and has_avx2_fallbacks ) {
+					return options::ExecModeTypes::avx2;
+				}
+#endif
+#if defined( DAW_ALLOW_SSE42 )
+				if( features.sse42 and features.pclmul ) {
+					return options::ExecModeTypes::simd;
+				}
+#endif
+				(void)features;
+				return options::ExecModeTypes::compile_time;
+			}
+
+			template<typename Function>
+			decltype( auto ) exec_mode_dispatch( options::ExecModeTypes mode,
+			                                     Function &&func ) {
+				switch( mode ) {
+#if defined( DAW_ALLOW_AVX2 )
+				case options::ExecModeTypes::avx2:
+					return DAW_FWD( func )(
+					  daw::constant<options::ExecModeTypes::avx2>{ } );
+#endif
+#if defined( DAW_ALLOW_SSE42 )
+				case options::ExecModeTypes::simd:
+					return DAW_FWD( func )(
+					  daw::constant<options::ExecModeTypes::simd>{ } );
+#endif
+				default:
+					return DAW_FWD( func )(
+					  daw::constant<options::ExecModeTypes::compile_time>{ } );
+				}
+			}
+
+			template<auto... PolicyFlags>
+			inline constexpr bool has_exec_mode_flag_v =
+			  ( std::is_same_v<daw::remove_cvref_t<decltype( PolicyFlags )>,
+			                   options::ExecModeTypes> or
+			    ... );
+		} // namespace json_details
+
+		/// @brief The exec mode used by the *_dispatch functions.  It is chosen
+		/// once, on first use, from the host CPU features and the modes enabled
+		/// via DAW_ALLOW_SSE42/DAW_ALLOW_AVX2.  Use options::to_string to get a
+		/// name for it
+		inline options::ExecModeTypes dispatch_exec_mode( ) {
+			static options::ExecModeTypes const mode =
+			  json_details::select_exec_mode( host_cpu_features( ) );
+			return mode;
+		}
+
+		/// @brief Call func with a daw::constant<ExecModeTypes> of the selected
+		/// exec mode.  This allows dispatching other entry points, e.g.
+		/// `func( auto mode ) { return json_array_range<T, decltype( mode
+		/// )::value>( doc ); }`
+		template<typename Function>
+		decltype( auto ) exec_mode_dispatch( Function &&func ) {
+			return json_details::exec_mode_dispatch( dispatch_exec_mode( ),
+			                                         DAW_FWD( func ) );
+		}
+
+		/// @brief Construct the JSONMember from the JSON document argument using
+		/// the fastest exec mode supported by the host.  See dispatch_exec_mode
+		/// @tparam JsonMember any bool, arithmetic, string, string_view,
+		/// daw::json::json_data_contract
+		/// @param json_data JSON string data
+		/// @tparam KnownBounds The bounds of the json_data are known to contain the
+		/// whole value
+		/// @return A reified JSONMember constructed from JSON data
+		/// @throws daw::json::json_exception
+		template<typename JsonMember, bool KnownBounds = false, typename String,
+		         auto... PolicyFlags>
+		[[nodiscard]] auto
+		from_json_dispatch( String &&json_data,
+		                    options::parse_flags_t<PolicyFlags...> ) {
+			static_assert( not json_details::has_exec_mode_flag_v<PolicyFlags...>,
+			               "The exec mode is chosen by from_json_dispatch" );
+			return exec_mode_dispatch( [&]( auto mode ) {
+				return from_json<JsonMember, KnownBounds>(
+				  DAW_FWD( json_data ),
+				  options::parse_flags<PolicyFlags..., decltype( mode )::value> );
+			} );
+		}
+
+		/// @brief Construct the JSONMember from the JSON document argument using
+		/// the fastest exec mode supported by the host.  See dispatch_exec_mode
+		/// @tparam JsonMember any bool, arithmetic, string, string_view,
+		/// daw::json::json_data_contract
+		/// @param json_data JSON string data
+		/// @tparam KnownBounds The bounds of the json_data are known to contain the
+		/// whole value
+		/// @return A reified JSONMember constructed from JSON data
+		/// @throws daw::json::json_exception
+		template<typename JsonMember, bool KnownBounds = false, typename String>
+		[[nodiscard]] auto from_json_dispatch( String &&json_data ) {
+			return from_json_dispatch<JsonMember, KnownBounds>(
+			  DAW_FWD( json_data ), options::parse_flags<> );
+		}
+
+		/// @brief Parse JSON data where the root item is an array using the
+		/// fastest exec mode supported by the host.  See dispatch_exec_mode
+		/// @tparam JsonElement The type of each element in array.
+		/// @tparam Container Container to store values in
+		/// @tparam Constructor Callable to construct Container with no arguments
+		/// @param json_data JSON string data containing array
+		/// @tparam KnownBounds The bounds of the json_data are known to contain the
+		/// whole value
+		/// @return A Container containing parsed data from JSON string
+		/// @throws daw::json::json_exception
+		template<typename JsonElement,
+		         typename Container =
+		           std::vector<json_details::from_json_result_t<JsonElement>>,
+		         typename Constructor = use_default, bool KnownBounds = false,
+		         typename String, auto... PolicyFlags>
+		[[nodiscard]] Container
+		from_json_array_dispatch( String &&json_data,
+		                          options::parse_flags_t<PolicyFlags...> ) {
+			static_assert( not json_details::has_exec_mode_flag_v<PolicyFlags...>,
+			               "The exec mode is chosen by from_json_array_dispatch" );
+			return exec_mode_dispatch( [&]( auto mode ) {
+				return from_json_array<JsonElement, Container, Constructor,
+				                       KnownBounds>(
+				  DAW_FWD( json_data ),
+				  options::parse_flags<PolicyFlags..., decltype( mode )::value> );
+			} );
+		}
+
+		/// @brief Parse JSON data where the root item is an array using the
+		/// fastest exec mode supported by the host.  See dispatch_exec_mode
+		/// @tparam JsonElement The type of each element in array.
+		/// @tparam Container Container to store values in
+		/// @tparam Constructor Callable to construct Container with no arguments
+		/// @param json_data JSON string data containing array
+		/// @tparam KnownBounds The bounds of the json_data are known to contain the
+		/// whole value
+		/// @return A Container containing parsed data from JSON string
+		/// @throws daw::json::json_exception
+		template<typename JsonElement,
+		         typename Container =
+		           std::vector<json_details::from_json_result_t<JsonElement>>,
+		         typename Constructor = use_default, bool KnownBounds = false,
+		         typename String>
+		[[nodiscard]] Container from_json_array_dispatch( String &&json_data ) {
+			return from_json_array_dispatch<JsonElement, Container, Constructor,
+			                                KnownBounds>( DAW_FWD( json_data ),
+			                                              options::parse_flags<> );
+		}
+
+		/// @brief Call func with a json_lines_range over jsonl_doc that uses the
+		/// fastest exec mode supported by the host.  As the range type depends on
+		/// the exec mode, func must accept any json_lines_range<JsonElement, ...>
+		/// @tparam JsonElement Type of each element in the document
+		/// @tparam PolicyFlags Parse options, excluding ExecModeTypes
+		/// @return The result of func
+		template<typename JsonElement = json_value, auto... PolicyFlags,
+		         typename Function>
+		decltype( auto ) json_lines_dispatch( daw::string_view jsonl_doc,
+		                                      Function &&func ) {
+			static_assert( not json_details::has_exec_mode_flag_v<PolicyFlags...>,
+			               "The exec mode is chosen by json_lines_dispatch" );
+			return exec_mode_dispatch( [&]( auto mode ) -> decltype( auto ) {
+				return func(
+				  json_lines_range<JsonElement, PolicyFlags..., decltype( mode )::value>(
+				    jsonl_doc ) );
+			} );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,236 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_json_exception.h"
+#include "daw_json_pointer.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_parse_name.h"
+#include "impl/daw_json_skip.h"
+#include "impl/daw_json_value.h"
+
+#include <daw/daw_string_view.h>
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			template<std::size_t N, typename ParseState>
+			struct extract_paths_state {
+				std::array<json_pointer_view, N> paths;
+				std::array<ParseState, N> found{ };
+				std::array<bool, N> is_found{ };
+				std::size_t remaining = N;
+			};
+
+			/***
+			 * Find the paths in active that lead into the value at the front of
+			 * parse_state, whose first depth tokens have been matched.  Values that
+			 * no active path leads into are skipped without being parsed.  Stops as
+			 * soon as every path is found, otherwise parse_state is left after the
+			 * value.
+			 */
+			template<std::size_t N, typename ParseState>
+			constexpr void extract_paths_walk( extract_paths_state<N, ParseState> &st,
+			                                   ParseState &parse_state,
+			                                   std::size_t depth,
+			                                   std::array<bool, N> active ) {
+				bool has_deeper = false;
+				for( std::size_t n = 0; n < N; ++n ) {
+					if( not active[n] ) {
+						continue;
+					}
+					if( st.paths[n].size( ) == depth ) {
+						active[n] = false;
+						if( not st.is_found[n] ) {
+							st.found[n] = parse_state;
+							st.is_found[n] = true;
+							--st.remaining;
+						}
+					} else {
+						has_deeper = true;
+					}
+				}
+				if( st.remaining == 0 ) {
+					return;
+				}
+				if( not has_deeper ) {
+					(void)skip_value( parse_state );
+					return;
+				}
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				switch( parse_state.front( ) ) {
+				case '{': {
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+					while( parse_state.is_quotes_checked( ) ) {
+						auto const name = parse_name( parse_state );
+						auto next = std::array<bool, N>{ };
+						bool has_next = false;
+						for( std::size_t n = 0; n < N; ++n ) {
+							if( active[n] and not st.is_found[n] and
+							    st.paths[n].name( depth ) == name ) {
+								next[n] = true;
+								has_next = true;
+							}
+						}
+						if( has_next ) {
+							extract_paths_walk( st, parse_state, depth + 1, next );
+							if( st.remaining == 0 ) {
+								return;
+							}
+						} else {
+							(void)skip_value( parse_state );
+						}
+						parse_state.move_next_member_or_end( );
+					}
+					daw_json_ensure( parse_state.has_more( ) and
+					                   parse_state.front( ) == '}',
+					                 ErrorReason::InvalidEndOfValue, parse_state );
+					parse_state.remove_prefix( );
+					return;
+				}
+				case '[': {
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+					std::size_t index = 0;
+					while( parse_state.has_more( ) and parse_state.front( ) != ']' ) {
+						auto next = std::array<bool, N>{ };
+						bool has_next = false;
+						for( std::size_t n = 0; n < N; ++n ) {
+							if( active[n] and st.paths[n].index( depth ) == index ) {
+								next[n] = true;
+								has_next = true;
+							}
+						}
+						if( has_next ) {
+							extract_paths_walk( st, parse_state, depth + 1, next );
+							if( st.remaining == 0 ) {
+								return;
+							}
+						} else {
+							(void)skip_value( parse_state );
+						}
+						parse_state.move_next_member_or_end( );
+						++index;
+					}
+					daw_json_ensure( parse_state.has_more( ),
+					                 ErrorReason::InvalidEndOfValue, parse_state );
+					parse_state.remove_prefix( );
+					return;
+				}
+				default:
+					(void)skip_value( parse_state );
+					return;
+				}
+			}
+
+			/// @brief Convert an extracted value to Result.  A missing value is an
+			/// error unless Result is a json_value or nullable
+			template<typename Result, json_options_t PolicyFlags, typename Allocator>
+			[[nodiscard]] constexpr Result
+			extracted_as( basic_json_value<PolicyFlags, Allocator> const &jv ) {
+				if constexpr( is_a_basic_json_value<Result> ) {
+					return static_cast<Result>( jv );
+				} else {
+					using result_t = json_deduced_type<Result>;
+					if( jv ) {
+						return jv.template as<Result>( );
+					}
+					if constexpr( is_json_nullable_v<result_t> ) {
+						using ParseState = typename basic_json_value<PolicyFlags,
+						                                             Allocator>::ParseState;
+						auto loc = ParseState{ };
+						return parse_value<result_t, true>(
+						  loc, ParseTag<result_t::expected_type>{ } );
+					} else {
+						daw_json_error( ErrorReason::JSONPathNotFound );
+					}
+				}
+			}
+
+			template<typename... Results, json_options_t PolicyFlags,
+			         typename Allocator, std::size_t N, std::size_t... Is>
+			[[nodiscard]] constexpr std::tuple<Results...> make_extracted_tuple(
+			  std::array<basic_json_value<PolicyFlags, Allocator>, N> const &values,
+			  std::index_sequence<Is...> ) {
+				return std::tuple<Results...>( extracted_as<Results>( values[Is] )... );
+			}
+		} // namespace json_details
+
+		/***
+		 * Find several values in one pass over the document.  Members and
+		 * elements that none of the paths lead into are skipped without being
+		 * parsed, and the walk stops once every path has been found.
+		 * @tparam Results Optional, the types to parse each value as.  Missing
+		 * values are an error unless the type is nullable or a json_value.  When
+		 * empty, the values are returned as basic_json_value's, empty when missing
+		 * @param jv The value the paths start at
+		 * @param pointers json_pointer<Path> or runtime_json_pointer's
+		 * @return A tuple with a value for each of pointers
+		 */
+		template<typename... Results, json_options_t PolicyFlags,
+		         typename Allocator, typename... JsonPointers>
+		[[nodiscard]] constexpr auto
+		extract_paths( basic_json_value<PolicyFlags, Allocator> const &jv,
+		               JsonPointers const &...pointers ) {
+			constexpr std::size_t N = sizeof...( JsonPointers );
+			static_assert( sizeof...( Results ) == 0 or sizeof...( Results ) == N,
+			               "A Result type is needed for each path" );
+			using json_value_t = basic_json_value<PolicyFlags, Allocator>;
+			using ParseState = typename json_value_t::ParseState;
+
+			auto values = std::array<json_value_t, N>{ };
+			if constexpr( N > 0 ) {
+				auto st = json_details::extract_paths_state<N, ParseState>{
+				  { pointers.view( )... } };
+				auto parse_state = jv.get_raw_state( );
+				auto active = std::array<bool, N>{ };
+				for( auto &a : active ) {
+					a = true;
+				}
+				json_details::extract_paths_walk( st, parse_state, 0, active );
+				for( std::size_t n = 0; n < N; ++n ) {
+					if( st.is_found[n] ) {
+						values[n] = json_value_t( st.found[n] );
+					}
+				}
+			}
+			if constexpr( sizeof...( Results ) == 0 ) {
+				return std::apply(
+				  []( auto const &...v ) {
+					  return std::make_tuple( v... );
+				  },
+				  values );
+			} else {
+				return json_details::make_extracted_tuple<Results...>(
+				  values, std::make_index_sequence<N>{ } );
+			}
+		}
+
+		/***
+		 * Find several values in one pass over json_doc.  See the
+		 * basic_json_value overload
+		 */
+		template<typename... Results, typename... JsonPointers>
+		[[nodiscard]] constexpr auto
+		extract_paths( daw::string_view json_doc,
+		               JsonPointers const &...pointers ) {
+			return extract_paths<Results...>( json_value( json_doc ), pointers... );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,283 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_json_exception.h"
+#include "daw_json_lines_iterator.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/daw_move.h>
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <utility>
+
+#if __has_include( <sys/mman.h> ) and __has_include( <sys/stat.h> ) and \
+  __has_include( <fcntl.h> ) and __has_include( <unistd.h> )
+#define DAW_JSON_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief The number of readable zero bytes that follow the data of a
+		/// json_mapped_file.  This covers the widest SIMD load and any unchecked
+		/// read past the end of the document
+		inline constexpr std::size_t json_file_padding = 64;
+
+		/// @brief Ask the OS to back a json_mapped_file with huge pages where it
+		/// is supported.  This is a hint and is ignored elsewhere
+		enum class JsonFileHugePages : bool { no, yes };
+
+		/// @brief A read only view of a whole file that is followed by at least
+		/// json_file_padding zero bytes.  Where mmap is available the file is
+		/// mapped and not copied, otherwise it is read into a buffer.  Passing it
+		/// to from_json/json_lines_range directly will use the zero terminated
+		/// parse paths and any string_view's parsed are valid as long as the
+		/// json_mapped_file is
+		class json_mapped_file {
+			char const *m_data = nullptr;
+			std::size_t m_size = 0;
+#if defined( DAW_JSON_HAS_MMAP )
+			std::size_t m_mapped_size = 0;
+#else
+			std::unique_ptr<char[]> m_buffer{ };
+#endif
+
+			void close( ) noexcept {
+#if defined( DAW_JSON_HAS_MMAP )
+				if( m_data != nullptr ) {
+					::munmap( const_cast<char *>( m_data ), m_mapped_size );
+				}
+				m_mapped_size = 0;
+#else
+				m_buffer.reset( );
+#endif
+				m_data = nullptr;
+				m_size = 0;
+			}
+
+		public:
+			json_mapped_file( ) = default;
+
+			/// @param path Path of the file to open
+			/// @param huge_pages Request huge pages for the mapping
+			/// @throws daw::json::json_exception with ErrorReason::InputError when
+			/// the file cannot be opened or read
+			explicit json_mapped_file(
+			  std::string const &path,
+			  JsonFileHugePages huge_pages = JsonFileHugePages::no ) {
+#if defined( DAW_JSON_HAS_MMAP )
+				int const fd = ::open( path.c_str( ), O_RDONLY | O_CLOEXEC );
+				daw_json_ensure( fd >= 0, ErrorReason::InputError );
+				struct ::stat st {};
+				if( ::fstat( fd, &st ) != 0 or st.st_size < 0 ) {
+					::close( fd );
+					daw_json_error( ErrorReason::InputError );
+				}
+				auto const file_size = static_cast<std::size_t>( st.st_size );
+				auto const page_size =
+				  static_cast<std::size_t>( ::sysconf( _SC_PAGESIZE ) );
+				// Reserve the file size plus the padding as zeroed anonymous memory and
+				// then map the file over the front of it.  The rest of the last page of
+				// the file is zero filled by the OS, as are the pages after it
+				auto const mapped_size =
+				  ( ( file_size + json_file_padding + page_size - 1 ) / page_size ) *
+				  page_size;
+				void *base = ::mmap( nullptr, mapped_size, PROT_READ,
+				                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+				if( base == MAP_FAILED ) {
+					::close( fd );
+					daw_json_error( ErrorReason::InputError );
+				}
+				if( file_size > 0 ) {
+					void *file_base = ::mmap( base, file_size, PROT_READ,
+					                          MAP_PRIVATE | MAP_FIXED, fd, 0 );
+					if( file_base == MAP_FAILED ) {
+						::munmap( base, mapped_size );
+						::close( fd );
+						daw_json_error( ErrorReason::InputError );
+					}
+#if defined( MADV_SEQUENTIAL )
+					(void)::madvise( file_base, file_size, MADV_SEQUENTIAL );
+#endif
+#if defined( MADV_HUGEPAGE )
+					if( huge_pages == JsonFileHugePages::yes ) {
+						(void)::madvise( file_base, file_size, MADV_HUGEPAGE );
+					}
+#endif
+				}
+				::close( fd );
+				(void)huge_pages;
+				m_data = static_cast<char const *>( base );
+				m_size = file_size;
+				m_mapped_size = mapped_size;
+#else
+				(void)huge_pages;
+				std::FILE *f = std::fopen( path.c_str( ), "rb" );
+				daw_json_ensure( f != nullptr, ErrorReason::InputError );
+				long file_size = -1;
+				if( std::fseek( f, 0, SEEK_END ) == 0 ) {
+					file_size = std::ftell( f );
+				}
+				if( file_size < 0 or std::fseek( f, 0, SEEK_SET ) != 0 ) {
+					std::fclose( f );
+					daw_json_error( ErrorReason::InputError );
+				}
+				auto const size = static_cast<std::size_t>( file_size );
+				m_buffer =
+				  std::unique_ptr<char[]>( new char[size + json_file_padding]{ } );
+				auto const count = std::fread( m_buffer.get( ), 1, size, f );
+				std::fclose( f );
+				daw_json_ensure( count == size, ErrorReason::InputError );
+				m_data = m_buffer.get( );
+				m_size = size;
+#endif
+			}
+
+			json_mapped_file( json_mapped_file const & ) = delete;
+			json_mapped_file &operator=( json_mapped_file const & ) = delete;
+
+			json_mapped_file( json_mapped_file &&other ) noexcept
+			  : m_data( std::exchange( other.m_data, nullptr ) )
+			  , m_size( std::exchange( other.m_size, 0 ) )
+#if defined( DAW_JSON_HAS_MMAP )
+			  , m_mapped_size( std::exchange( other.m_mapped_size, 0 ) )
+#else
+			  , m_buffer( DAW_MOVE( other.m_buffer ) )
+#endif
+			{
+			}
+
+			json_mapped_file &operator=( json_mapped_file &&rhs ) noexcept {
+				if( this != &rhs ) {
+					close( );
+					m_data = std::exchange( rhs.m_data, nullptr );
+					m_size = std::exchange( rhs.m_size, 0 );
+#if defined( DAW_JSON_HAS_MMAP )
+					m_mapped_size = std::exchange( rhs.m_mapped_size, 0 );
+#else
+					m_buffer = DAW_MOVE( rhs.m_buffer );
+#endif
+				}
+				return *this;
+			}
+
+			~json_mapped_file( ) {
+				close( );
+			}
+
+			/// @brief The file contents.  data( )[size( )] through
+			/// data( )[size( ) + json_file_padding - 1] are readable and zero
+			[[nodiscard]] char const *data( ) const {
+				return m_data;
+			}
+
+			[[nodiscard]] std::size_t size( ) const {
+				return m_size;
+			}
+
+			[[nodiscard]] bool empty( ) const {
+				return m_size == 0;
+			}
+
+			[[nodiscard]] daw::string_view view( ) const {
+				return daw::string_view( m_data, m_size );
+			}
+		};
+
+		/// @brief The data of a json_mapped_file is followed by zero bytes
+		template<>
+		inline constexpr bool is_zero_terminated_string_v<json_mapped_file> = true;
+
+		/// @brief Parse the whole file at path as a JsonElement without copying
+		/// it into a string first.  The zero terminated parse paths are used.
+		/// The result must own its data, as the file is closed before returning
+		/// @tparam JsonElement Type to parse the document as
+		/// @param path Path of the JSON document
+		/// @param huge_pages Request huge pages for the mapping
+		/// @return A reified JsonElement constructed from the file
+		/// @throws daw::json::json_exception
+		template<typename JsonElement, auto... PolicyFlags>
+		[[nodiscard]] auto
+		from_json_file( std::string const &path,
+		                options::parse_flags_t<PolicyFlags...> flags,
+		                JsonFileHugePages huge_pages = JsonFileHugePages::no ) {
+			auto const file = json_mapped_file( path, huge_pages );
+			return from_json<JsonElement>( file, flags );
+		}
+
+		/// @brief Parse the whole file at path as a JsonElement without copying
+		/// it into a string first.  The zero terminated parse paths are used.
+		/// The result must own its data, as the file is closed before returning
+		/// @tparam JsonElement Type to parse the document as
+		/// @param path Path of the JSON document
+		/// @param huge_pages Request huge pages for the mapping
+		/// @return A reified JsonElement constructed from the file
+		/// @throws daw::json::json_exception
+		template<typename JsonElement>
+		[[nodiscard]] auto
+		from_json_file( std::string const &path,
+		                JsonFileHugePages huge_pages = JsonFileHugePages::no ) {
+			return from_json_file<JsonElement>( path, options::parse_flags<>,
+			                                    huge_pages );
+		}
+
+		/// @brief A range over the records of a JSON Lines file that owns the
+		/// mapping of the file.  The zero terminated parse paths are used and
+		/// views into the records are valid as long as the range is.
+		/// @tparam JsonElement Type of each record
+		/// @tparam PolicyFlags Parse options for the records
+		template<typename JsonElement = json_value, auto... PolicyFlags>
+		class json_lines_file_range {
+			json_mapped_file m_file;
+
+		public:
+			using iterator =
+			  json_lines_iterator<JsonElement, options::ZeroTerminatedString::yes,
+			                      PolicyFlags...>;
+
+			/// @param path Path of the JSON Lines document
+			/// @param huge_pages Request huge pages for the mapping
+			/// @throws daw::json::json_exception with ErrorReason::InputError when
+			/// the file cannot be opened or read
+			explicit json_lines_file_range(
+			  std::string const &path,
+			  JsonFileHugePages huge_pages = JsonFileHugePages::no )
+			  : m_file( path, huge_pages ) {}
+
+			/// @return first item in range
+			[[nodiscard]] iterator begin( ) const {
+				if( m_file.empty( ) ) {
+					return iterator( );
+				}
+				return iterator( m_file.view( ) );
+			}
+
+			/// @return one past last item in range
+			[[nodiscard]] iterator end( ) const {
+				return iterator( );
+			}
+
+			/// @brief The mapped file
+			[[nodiscard]] json_mapped_file const &file( ) const {
+				return m_file;
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,218 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_arena.h"
+#include "impl/daw_json_parse_common.h"
+#include "impl/daw_murmur3.h"
+
+#include <daw/daw_string_view.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_set>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief The process wide pool that interned_string values are stored in.
+		/// Each distinct value is stored once and never freed, so it is meant for
+		/// low cardinality values like status codes, country codes and host
+		/// names.  The pool is split into shards with their own lock and each
+		/// thread keeps a small cache in front of it, so repeated values are
+		/// found without taking a lock.
+		class json_string_pool {
+			static constexpr std::size_t shard_count = 64;
+			static constexpr std::size_t thread_cache_size = 1024;
+
+			struct shard {
+				std::mutex mutex{ };
+				std::unordered_set<std::string_view> values{ };
+				json_arena storage{ 16U * 1024U };
+			};
+
+			struct cache_entry {
+				char const *data = nullptr;
+				std::size_t size = 0;
+				std::uint32_t hash = 0;
+			};
+
+			std::unique_ptr<shard[]> m_shards =
+			  std::unique_ptr<shard[]>( new shard[shard_count] );
+
+			json_string_pool( ) = default;
+
+			[[nodiscard]] static std::uint32_t hash_of( std::string_view value ) {
+				return static_cast<std::uint32_t>( daw::murmur3_32( value ) );
+			}
+
+			[[nodiscard]] std::string_view intern_slow( std::string_view value,
+			                                            std::uint32_t hash ) {
+				auto &s = m_shards[hash % shard_count];
+				auto const lck = std::lock_guard<std::mutex>( s.mutex );
+				auto pos = s.values.find( value );
+				if( pos == s.values.end( ) ) {
+					auto *ptr = static_cast<char *>(
+					  s.storage.allocate( value.size( ) + 1U, 1U ) );
+					std::memcpy( ptr, value.data( ), value.size( ) );
+					ptr[value.size( )] = '\0';
+					pos =
+					  s.values.insert( std::string_view( ptr, value.size( ) ) ).first;
+				}
+				return *pos;
+			}
+
+		public:
+			json_string_pool( json_string_pool const & ) = delete;
+			json_string_pool &operator=( json_string_pool const & ) = delete;
+
+			/// @brief The pool.  It is never destroyed so that interned values stay
+			/// valid during static destruction
+			[[nodiscard]] static json_string_pool &global( ) {
+				static json_string_pool *const pool = new json_string_pool( );
+				return *pool;
+			}
+
+			/// @brief Find or add value to the pool
+			/// @return A view of the pooled copy of value.  It is zero terminated and
+			/// valid for the life of the process
+			[[nodiscard]] std::string_view intern( std::string_view value ) {
+				static thread_local std::array<cache_entry, thread_cache_size>
+				  cache{ };
+				auto const hash = hash_of( value );
+				auto &entry = cache[hash % thread_cache_size];
+				if( entry.hash == hash and entry.size == value.size( ) and
+				    entry.data != nullptr and
+				    std::memcmp( entry.data, value.data( ), value.size( ) ) == 0 ) {
+					return std::string_view( entry.data, entry.size );
+				}
+				auto const result = intern_slow( value, hash );
+				entry = cache_entry{ result.data( ), result.size( ), hash };
+				return result;
+			}
+
+			/// @brief The number of distinct values in the pool
+			[[nodiscard]] std::size_t size( ) {
+				std::size_t result = 0;
+				for( std::size_t n = 0; n < shard_count; ++n ) {
+					auto const lck = std::lock_guard<std::mutex>( m_shards[n].mutex );
+					result += m_shards[n].values.size( );
+				}
+				return result;
+			}
+		};
+
+		/// @brief A handle to a string stored once in json_string_pool.  Parsing
+		/// a json_string without escapes into an interned_string does not
+		/// allocate when the value has been seen before.  A value with escapes is
+		/// unescaped into a temporary std::string before the lookup.  Copies are
+		/// a pointer and a size, and equal values always have the same data( ),
+		/// so comparison is by address.
+		class interned_string {
+			std::string_view m_value{ };
+
+		public:
+			using value_type = char;
+			using const_iterator = char const *;
+			using iterator = const_iterator;
+
+			interned_string( ) = default;
+
+			explicit interned_string( std::string_view value )
+			  : m_value( value.empty( )
+			               ? std::string_view( )
+			               : json_string_pool::global( ).intern( value ) ) {}
+
+			interned_string( char const *first, char const *last )
+			  : interned_string( std::string_view(
+			      first, static_cast<std::size_t>( last - first ) ) ) {}
+
+			interned_string( char const *ptr, std::size_t size )
+			  : interned_string( std::string_view( ptr, size ) ) {}
+
+			/// @brief The interned value, zero terminated unless empty
+			[[nodiscard]] char const *data( ) const {
+				return m_value.data( );
+			}
+
+			[[nodiscard]] std::size_t size( ) const {
+				return m_value.size( );
+			}
+
+			[[nodiscard]] bool empty( ) const {
+				return m_value.empty( );
+			}
+
+			[[nodiscard]] const_iterator begin( ) const {
+				return m_value.data( );
+			}
+
+			[[nodiscard]] const_iterator end( ) const {
+				return m_value.data( ) + m_value.size( );
+			}
+
+			[[nodiscard]] std::string_view view( ) const {
+				return m_value;
+			}
+
+			operator std::string_view( ) const {
+				return m_value;
+			}
+
+			[[nodiscard]] friend bool operator==( interned_string const &lhs,
+			                                      interned_string const &rhs ) {
+				return lhs.m_value.data( ) == rhs.m_value.data( ) and
+				       lhs.m_value.size( ) == rhs.m_value.size( );
+			}
+
+			[[nodiscard]] friend bool operator!=( interned_string const &lhs,
+			                                      interned_string const &rhs ) {
+				return not( lhs == rhs );
+			}
+
+			[[nodiscard]] friend bool operator==( interned_string const &lhs,
+			                                      std::string_view rhs ) {
+				return lhs.m_value == rhs;
+			}
+
+			[[nodiscard]] friend bool operator!=( interned_string const &lhs,
+			                                      std::string_view rhs ) {
+				return lhs.m_value != rhs;
+			}
+		};
+
+		namespace json_details {
+			template<>
+			struct json_deduced_type_map<interned_string> {
+				static constexpr bool is_null = false;
+				static constexpr JsonParseTypes parse_type =
+				  JsonParseTypes::StringEscaped;
+
+				static constexpr bool type_map_found = true;
+			};
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
+
+namespace std {
+	template<>
+	struct hash<daw::json::interned_string> {
+		[[nodiscard]] std::size_t
+		operator( )( daw::json::interned_string const &value ) const noexcept {
+			return std::hash<char const *>{ }( value.data( ) );
+		}
+	};
+} // namespace std
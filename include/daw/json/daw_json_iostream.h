@@ -10,6 +10,7 @@
 
 #include "impl/version.h"
 
+#include "daw_json_buffered_output.h"
 #include "daw_json_link.h"
 
 #include <daw/daw_traits.h>
@@ -40,19 +41,26 @@ namespace daw::json {
 } // namespace daw::json
 
 /// @brief An opt in ostream interface for types that have JSON mappings.
+/// The output is passed to os in blocks
 template<typename T>
 auto operator<<( std::ostream &os, T const &value ) -> std::enable_if_t<
   daw::json::json_details::is_opted_into_json_iostreams_v<T>, std::ostream &> {
 
-	return daw::json::to_json( value, os );
+	auto out = daw::json::buffered_output<std::ostream>( os );
+	(void)daw::json::to_json( value, out );
+	out.flush( );
+	return os;
 }
 
 /// @brief An opt in ostream interface for containers of types that have JSON
-/// mappings.
+/// mappings.  The output is passed to os in blocks
 template<typename Container>
 auto operator<<( std::ostream &os, Container const &c ) -> std::enable_if_t<
   daw::json::json_details::is_container_opted_into_json_iostreams_v<Container>,
   std::ostream &> {
 
-	return daw::json::to_json_array( c, os );
+	auto out = daw::json::buffered_output<std::ostream>( os );
+	(void)daw::json::to_json_array( c, out );
+	out.flush( );
+	return os;
 }
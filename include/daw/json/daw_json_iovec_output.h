@@ -0,0 +1,217 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "concepts/daw_writable_output.h"
+#include "daw_json_arena.h"
+#include "daw_json_exception.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if __has_include( <sys/uio.h> ) and __has_include( <unistd.h> )
+#define DAW_JSON_HAS_WRITEV
+#include <cerrno>
+#include <climits>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief A piece of the output of a json_iovec_output
+		struct json_iovec_part {
+			char const *data;
+			std::size_t size;
+		};
+
+		/// @brief A writable output that records the document as a list of parts
+		/// instead of one buffer.  Small pieces are copied into a staging arena
+		/// and adjacent ones share a part.  The data of string members that is at
+		/// least reference_threshold bytes is not copied, the part refers to the
+		/// member.  The values serialized must outlive the output, or the next
+		/// clear( ), and must not be changed until then.  When to_json_data
+		/// returns a string member by value, its data is destroyed before the
+		/// document is flushed, so return members by reference, e.g. with
+		/// std::forward_as_tuple.
+		class json_iovec_output {
+			std::vector<json_iovec_part> m_parts{ };
+			json_arena m_staging;
+			std::size_t m_reference_threshold;
+			std::size_t m_size = 0;
+
+			void append( char const *data, std::size_t size ) {
+				m_size += size;
+				if( not m_parts.empty( ) ) {
+					auto &last = m_parts.back( );
+					if( last.data + last.size == data ) {
+						last.size += size;
+						return;
+					}
+				}
+				m_parts.push_back( json_iovec_part{ data, size } );
+			}
+
+			void stage( daw::string_view sv ) {
+				if( sv.empty( ) ) {
+					return;
+				}
+				auto *ptr = static_cast<char *>( m_staging.allocate( sv.size( ), 1 ) );
+				std::memcpy( ptr, sv.data( ), sv.size( ) );
+				append( ptr, sv.size( ) );
+			}
+
+		public:
+			static constexpr std::size_t default_reference_threshold = 512;
+
+			/// @param reference_threshold The size from which string member data is
+			/// referenced instead of copied
+			/// @param staging_chunk_size Size of the first chunk of the staging
+			/// arena
+			explicit json_iovec_output(
+			  std::size_t reference_threshold = default_reference_threshold,
+			  std::size_t staging_chunk_size = 4096 )
+			  : m_staging( staging_chunk_size )
+			  , m_reference_threshold( reference_threshold ) {}
+
+			json_iovec_output( json_iovec_output const & ) = delete;
+			json_iovec_output &operator=( json_iovec_output const & ) = delete;
+
+			template<typename... StringViews>
+			void write( StringViews const &...svs ) {
+				( stage( daw::string_view( svs ) ), ... );
+			}
+
+			void write_reference( daw::string_view sv ) {
+				if( sv.empty( ) or sv.size( ) < m_reference_threshold ) {
+					stage( sv );
+					return;
+				}
+				append( sv.data( ), sv.size( ) );
+			}
+
+			void put( char c ) {
+				stage( daw::string_view( &c, 1 ) );
+			}
+
+			/// @brief The parts of the document, in order
+			[[nodiscard]] std::vector<json_iovec_part> const &parts( ) const {
+				return m_parts;
+			}
+
+			/// @brief Size of the document in bytes
+			[[nodiscard]] std::size_t size( ) const {
+				return m_size;
+			}
+
+			/// @brief Forget the document.  The staging memory is kept for the next
+			/// one
+			void clear( ) {
+				m_parts.clear( );
+				m_staging.reset( );
+				m_size = 0;
+			}
+
+			/// @brief Copy the document into a std::string
+			[[nodiscard]] std::string to_string( ) const {
+				auto result = std::string( );
+				result.reserve( m_size );
+				for( auto const &part : m_parts ) {
+					result.append( part.data, part.size );
+				}
+				return result;
+			}
+
+			/// @brief Write the document to another writable output, part by part
+			template<typename WritableOutput>
+			void write_to( WritableOutput &out ) const {
+				for( auto const &part : m_parts ) {
+					write_output( out, daw::string_view( part.data, part.size ) );
+				}
+			}
+
+#if defined( DAW_JSON_HAS_WRITEV )
+			/// @brief Write the whole document to the file descriptor fd with as few
+			/// writev calls as IOV_MAX allows, then clear( )
+			/// @throws daw::json::json_exception with ErrorReason::OutputError when
+			/// writing fails
+			void writev( int fd ) {
+#if defined( IOV_MAX )
+				constexpr std::size_t max_iov = IOV_MAX < 1024 ? IOV_MAX : 1024;
+#else
+				constexpr std::size_t max_iov = 16;
+#endif
+				::iovec iov[max_iov];
+				std::size_t next_part = 0;
+				// Bytes of m_parts[next_part] that have already been written
+				std::size_t part_offset = 0;
+				while( next_part < m_parts.size( ) ) {
+					std::size_t iov_count = 0;
+					for( auto n = next_part;
+					     n < m_parts.size( ) and iov_count < max_iov;
+					     ++n, ++iov_count ) {
+						auto const offset = n == next_part ? part_offset : 0;
+						iov[iov_count].iov_base =
+						  const_cast<char *>( m_parts[n].data + offset );
+						iov[iov_count].iov_len = m_parts[n].size - offset;
+					}
+					auto const written =
+					  ::writev( fd, iov, static_cast<int>( iov_count ) );
+					if( written < 0 ) {
+						daw_json_ensure( errno == EINTR, ErrorReason::OutputError );
+						continue;
+					}
+					daw_json_ensure( written > 0, ErrorReason::OutputError );
+					// Skip the parts that were written completely
+					auto remaining = static_cast<std::size_t>( written );
+					while( next_part < m_parts.size( ) and
+					       remaining >= m_parts[next_part].size - part_offset ) {
+						remaining -= m_parts[next_part].size - part_offset;
+						part_offset = 0;
+						++next_part;
+					}
+					part_offset += remaining;
+				}
+				clear( );
+			}
+#endif
+		};
+
+		namespace concepts {
+			/// @brief Specialization for json_iovec_output
+			template<>
+			struct writable_output_trait<json_iovec_output> : std::true_type {
+
+				template<typename... StringViews>
+				static inline void write( json_iovec_output &out,
+				                          StringViews const &...svs ) {
+					static_assert( sizeof...( StringViews ) > 0 );
+					out.write( svs... );
+				}
+
+				static inline void write_reference( json_iovec_output &out,
+				                                    daw::string_view sv ) {
+					out.write_reference( sv );
+				}
+
+				static inline void put( json_iovec_output &out, char c ) {
+					out.put( c );
+				}
+			};
+		} // namespace concepts
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,118 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_json_link_types.h"
+
+#include <daw/daw_move.h>
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <optional>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * Holds the JSON text of a value and parses it as T on first access.  The
+		 * parsed value is cached, and a value that was never accessed is
+		 * serialized verbatim.  Like json_value, the JSON document must outlive
+		 * it.  The cache is filled by const accessors, so sharing one between
+		 * threads requires that it is accessed once first.
+		 * @tparam T The type to parse the value as
+		 */
+		template<typename T>
+		class json_lazy_value {
+			daw::string_view m_raw{ };
+			mutable std::optional<T> m_value{ };
+
+		public:
+			using i_am_a_json_lazy_value = void;
+			using value_type = T;
+
+			json_lazy_value( ) = default;
+
+			/// @brief Construct from the JSON text of a value
+			constexpr json_lazy_value( char const *ptr, std::size_t sz )
+			  : m_raw( ptr, sz ) {}
+
+			/// @brief Construct from a value, as when serializing a new object
+			explicit json_lazy_value( T value )
+			  : m_value( DAW_MOVE( value ) ) {}
+
+			/// @brief Has the value been parsed or assigned
+			[[nodiscard]] bool has_value( ) const {
+				return m_value.has_value( );
+			}
+
+			/// @brief The JSON text of the value
+			[[nodiscard]] constexpr daw::string_view get_raw( ) const {
+				return m_raw;
+			}
+
+			/// @brief The value, parsing it on first access
+			/// @throws daw::json::json_exception
+			[[nodiscard]] T const &get( ) const {
+				if( not m_value ) {
+					m_value.emplace( from_json<T>( m_raw ) );
+				}
+				return *m_value;
+			}
+
+			/// @brief The value, parsing it on first access.  Changes to it are
+			/// serialized instead of the JSON text
+			/// @throws daw::json::json_exception
+			[[nodiscard]] T &get( ) {
+				if( not m_value ) {
+					m_value.emplace( from_json<T>( m_raw ) );
+				}
+				return *m_value;
+			}
+
+			[[nodiscard]] T const &operator*( ) const {
+				return get( );
+			}
+
+			[[nodiscard]] T &operator*( ) {
+				return get( );
+			}
+
+			[[nodiscard]] T const *operator->( ) const {
+				return &get( );
+			}
+
+			[[nodiscard]] T *operator->( ) {
+				return &get( );
+			}
+		};
+
+		/***
+		 * json_lazy is a class member whose value is parsed on first access.
+		 * Parsing the class only skips over the value, as with json_raw, and the
+		 * member is serialized verbatim unless it was accessed.  This suits large
+		 * values that are seldom read
+		 * @tparam Name json member name
+		 * @tparam T type the value is parsed as, the member type is
+		 * json_lazy_value<T>
+		 */
+		template<JSONNAMETYPE Name, typename T>
+		using json_lazy = json_raw<Name, json_lazy_value<T>>;
+
+		/***
+		 * json_lazy_no_name is a value that is parsed on first access, e.g. as
+		 * the element of a json_array.  See json_lazy
+		 * @tparam T type the value is parsed as, the element type is
+		 * json_lazy_value<T>
+		 */
+		template<typename T>
+		using json_lazy_no_name = json_raw_no_name<json_lazy_value<T>>;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,946 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_lines_iterator.h"
+#include "daw_json_parse_options.h"
+#include "daw_json_serialize_options.h"
+#include "daw_to_json.h"
+#include "impl/daw_json_parse_class.h"
+#include "impl/daw_json_parse_policy.h"
+#include "impl/daw_json_skip.h"
+
+#include <daw/daw_likely.h>
+#include <daw/daw_move.h>
+#include <daw/daw_string_view.h>
+#include <daw/daw_traits.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// An Executor, as used by the *_parallel functions, is a callable with the
+/// signature `void( std::size_t task_count, Task task )`.  It must call
+/// `task( n )` once for each n in [0, task_count), possibly concurrently, and
+/// return after all of them have finished.  Tasks do not throw.  If the executor
+/// has a `concurrency( )` member, it is used to decide how many tasks to create.
+/// This allows adapting an existing thread pool with a small lambda.
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief The default Executor for the *_parallel functions.  Each call
+		/// starts up to thread_count threads, including the calling thread, that
+		/// claim the next unstarted task when they finish one.  This balances
+		/// uneven tasks without a shared queue of work
+		class json_thread_executor {
+			std::size_t m_thread_count;
+
+		public:
+			explicit json_thread_executor(
+			  std::size_t thread_count = std::thread::hardware_concurrency( ) )
+			  : m_thread_count( thread_count == 0 ? 1 : thread_count ) {}
+
+			[[nodiscard]] std::size_t concurrency( ) const {
+				return m_thread_count;
+			}
+
+			template<typename Task>
+			void operator( )( std::size_t task_count, Task &&task ) const {
+				auto next_task = std::atomic<std::size_t>{ 0 };
+				auto const worker = [&] {
+					for( std::size_t n = next_task.fetch_add( 1, std::memory_order_relaxed );
+					     n < task_count;
+					     n = next_task.fetch_add( 1, std::memory_order_relaxed ) ) {
+						task( n );
+					}
+				};
+				auto const thread_count = ( std::min )( m_thread_count, task_count );
+				auto threads = std::vector<std::thread>( );
+				if( thread_count > 1 ) {
+					threads.reserve( thread_count - 1 );
+				}
+				for( std::size_t n = 1; n < thread_count; ++n ) {
+#if defined( DAW_USE_EXCEPTIONS )
+					try {
+#endif
+						threads.emplace_back( worker );
+#if defined( DAW_USE_EXCEPTIONS )
+					} catch( std::system_error const & ) {
+						// Run with the threads that could be started
+						break;
+					}
+#endif
+				}
+				worker( );
+				for( auto &t : threads ) {
+					t.join( );
+				}
+			}
+		};
+
+		namespace json_details {
+			template<typename Executor>
+			using executor_concurrency_test =
+			  decltype( std::declval<Executor const &>( ).concurrency( ) );
+
+			template<typename Executor>
+			std::size_t executor_concurrency( Executor const &executor ) {
+				if constexpr( daw::is_detected_v<executor_concurrency_test,
+				                                 Executor> ) {
+					return ( std::max )(
+					  static_cast<std::size_t>( executor.concurrency( ) ),
+					  std::size_t{ 1 } );
+				} else {
+					(void)executor;
+					return ( std::max )(
+					  static_cast<std::size_t>( std::thread::hardware_concurrency( ) ),
+					  std::size_t{ 1 } );
+				}
+			}
+
+			/***
+			 * @brief Run task( n ) for n in [0, task_count) on the executor.  Tasks
+			 * after one that failed are skipped, earlier ones still run, and the
+			 * exception of the first failed task is rethrown.  As tasks are in
+			 * document order, this reports the first error in the document
+			 */
+			template<typename Executor, typename Task>
+			void run_parallel_tasks( Executor &executor, std::size_t task_count,
+			                         Task &task ) {
+#if defined( DAW_USE_EXCEPTIONS )
+				auto errors = std::vector<std::exception_ptr>( task_count );
+				auto first_failed = std::atomic<std::size_t>( task_count );
+				executor( task_count, [&]( std::size_t n ) {
+					if( n > first_failed.load( std::memory_order_relaxed ) ) {
+						return;
+					}
+					try {
+						task( n );
+					} catch( ... ) {
+						errors[n] = std::current_exception( );
+						auto failed = first_failed.load( std::memory_order_relaxed );
+						while( n < failed and not first_failed.compare_exchange_weak(
+						                        failed, n, std::memory_order_relaxed ) ) {}
+					}
+				} );
+				for( auto const &error : errors ) {
+					if( error ) {
+						std::rethrow_exception( error );
+					}
+				}
+#else
+				executor( task_count, task );
+#endif
+			}
+
+			/// More tasks than threads lets the executor balance elements that
+			/// take longer than others to parse
+			inline constexpr std::size_t parallel_tasks_per_thread = 4;
+
+			/// JSON Lines documents are split into many small chunks so that threads
+			/// that get short lines keep claiming work while others parse long ones
+			inline constexpr std::size_t parallel_jsonl_tasks_per_thread = 16;
+			inline constexpr std::size_t parallel_jsonl_min_chunk_size = 16U * 1024U;
+
+			template<typename Executor>
+			std::size_t jsonl_chunk_count( Executor const &executor,
+			                               std::size_t doc_size ) {
+				return ( std::max )(
+				  ( std::min )( executor_concurrency( executor ) *
+				                  parallel_jsonl_tasks_per_thread,
+				                doc_size / parallel_jsonl_min_chunk_size ),
+				  std::size_t{ 1 } );
+			}
+
+			/// Serializing an element is cheap, so chunks smaller than this are not
+			/// worth a task
+			inline constexpr std::size_t parallel_serialize_min_chunk_size = 256;
+
+			/// @brief Serialize the elements [first, first + count) the way
+			/// to_json_array does, starting one level of indentation in.  A comma
+			/// follows each element unless it is the last of the array
+			template<typename JsonElement, json_options_t SerializationFlags,
+			         typename Iterator>
+			void serialize_array_chunk( std::string &buffer, Iterator first,
+			                            std::size_t count, bool is_last_chunk ) {
+				auto out_it = serialization_policy<std::string, SerializationFlags>(
+				  buffer );
+				out_it.add_indent( );
+				for( std::size_t n = 0; n < count; ++n, ++first ) {
+					(void)[&out_it]( auto &&v ) {
+						using v_type = DAW_TYPEOF( v );
+						using JsonMember = typename std::conditional_t<
+						  std::is_same_v<JsonElement, use_default>,
+						  json_details::ident_trait<json_details::json_deduced_type,
+						                            v_type>,
+						  json_details::ident_trait<json_details::json_deduced_type,
+						                            JsonElement>>::type;
+
+						static_assert(
+						  not std::is_same_v<
+						    JsonMember,
+						    missing_json_data_contract_for_or_unknown_type<JsonElement>>,
+						  "Unable to detect unnamed mapping" );
+						out_it.next_member( );
+						out_it = json_details::member_to_string( template_arg<JsonMember>,
+						                                         out_it, v );
+					}
+					( *first );
+					if( n + 1 < count or not is_last_chunk ) {
+						out_it.put( ',' );
+					}
+				}
+			}
+
+			/// Arrays are split into byte ranges of at least this size, smaller
+			/// ones are not worth a task
+			inline constexpr std::size_t parallel_array_min_chunk_size =
+			  16U * 1024U;
+
+			/// @brief How scanning a byte range of an array changes whether the
+			/// scan is in a string and the bracket depth.  Indexed by whether the
+			/// range starts in a string
+			struct array_range_summary {
+				std::array<bool, 2> ends_in_string{ };
+				std::array<std::ptrdiff_t, 2> depth_change{ };
+				/// The lowest depth reached, relative to the start of the range
+				std::array<std::ptrdiff_t, 2> min_depth{ };
+			};
+
+			/// @brief A byte range of the elements of a JSON array.  It holds the
+			/// elements whose preceding separator, the opening bracket or a comma,
+			/// is in the range
+			template<typename CharT>
+			struct parallel_array_chunk {
+				CharT *first;
+				CharT *last;
+				/// The state at first, the array's opening bracket is at depth 1
+				bool in_string = false;
+				std::ptrdiff_t depth = 1;
+				/// The first separator in the range, or the closing bracket of the
+				/// array when that comes first
+				CharT *first_separator = nullptr;
+				/// The separator following the last element of the range
+				CharT *end_separator = nullptr;
+				/// Index of the first element in the whole array
+				std::size_t index = 0;
+				/// The number of separators in the range.  The last one of the
+				/// array can be followed by the closing bracket instead of an element
+				std::size_t count = 0;
+				std::size_t parsed = 0;
+			};
+
+			/***
+			 * @brief Scan [first, last) for strings and brackets, without knowing
+			 * whether it starts in a string.  last[-1] is not a backslash, so no
+			 * escape crosses the end of the range
+			 */
+			template<typename CharT>
+			[[nodiscard]] array_range_summary summarize_array_range( CharT *first,
+			                                                         CharT *last ) {
+				auto result = array_range_summary{ };
+				for( int start_in_string = 0; start_in_string < 2; ++start_in_string ) {
+					bool in_string = start_in_string == 1;
+					std::ptrdiff_t depth = 0;
+					std::ptrdiff_t min_depth = 0;
+					for( auto *ptr = first; ptr != last; ++ptr ) {
+						char const c = *ptr;
+						if( in_string ) {
+							if( c == '\\' ) {
+								if( ptr + 1 == last ) {
+									break;
+								}
+								++ptr;
+							} else if( c == '"' ) {
+								in_string = false;
+							}
+							continue;
+						}
+						switch( c ) {
+						case '"':
+							in_string = true;
+							break;
+						case '[':
+						case '{':
+							++depth;
+							break;
+						case ']':
+						case '}':
+							--depth;
+							min_depth = ( std::min )( min_depth, depth );
+							break;
+						default:
+							break;
+						}
+					}
+					result.ends_in_string[start_in_string] = in_string;
+					result.depth_change[start_in_string] = depth;
+					result.min_depth[start_in_string] = min_depth;
+				}
+				return result;
+			}
+
+			/***
+			 * @brief Find the separators at the top level of the array in the range
+			 * of chunk, using the state at its start.  Scanning stops at the
+			 * closing bracket of the array
+			 */
+			template<typename CharT>
+			void find_array_separators( parallel_array_chunk<CharT> &chunk ) {
+				if( chunk.depth < 1 ) {
+					// The array ended in an earlier range
+					return;
+				}
+				bool in_string = chunk.in_string;
+				std::ptrdiff_t depth = chunk.depth;
+				for( auto *ptr = chunk.first; ptr != chunk.last; ++ptr ) {
+					char const c = *ptr;
+					if( in_string ) {
+						if( c == '\\' ) {
+							if( ptr + 1 == chunk.last ) {
+								break;
+							}
+							++ptr;
+						} else if( c == '"' ) {
+							in_string = false;
+						}
+						continue;
+					}
+					switch( c ) {
+					case '"':
+						in_string = true;
+						break;
+					case '[':
+					case '{':
+						++depth;
+						break;
+					case ']':
+					case '}':
+						if( --depth == 0 ) {
+							if( chunk.first_separator == nullptr ) {
+								chunk.first_separator = ptr;
+							}
+							return;
+						}
+						break;
+					case ',':
+						if( depth == 1 ) {
+							if( chunk.first_separator == nullptr ) {
+								chunk.first_separator = ptr;
+							}
+							++chunk.count;
+						}
+						break;
+					default:
+						break;
+					}
+				}
+			}
+
+			/***
+			 * @brief Split the array parse_state is at into byte ranges and find
+			 * the elements each one holds.  The ranges are scanned in parallel, only
+			 * a summary of each is combined in order, so no pass over the whole
+			 * array runs on a single thread.  Elements are not parsed
+			 * @param parse_state Positioned at the opening bracket of the array
+			 * @param chunk_count The number of ranges wanted
+			 */
+			template<typename ParseState, typename Executor>
+			std::vector<parallel_array_chunk<typename ParseState::CharT>>
+			partition_json_array( ParseState &parse_state, std::size_t chunk_count,
+			                      Executor &executor ) {
+				using CharT = typename ParseState::CharT;
+				using chunk_t = parallel_array_chunk<CharT>;
+
+				parse_state.trim_left( );
+				daw_json_assert_weak( parse_state.is_opening_bracket_checked( ),
+				                      ErrorReason::InvalidArrayStart, parse_state );
+				CharT *const open_bracket = parse_state.first;
+				CharT *const first = open_bracket + 1;
+				CharT *const last = parse_state.last;
+				auto const size = static_cast<std::size_t>( last - first );
+				chunk_count = ( std::max )(
+				  ( std::min )( chunk_count, size / parallel_array_min_chunk_size ),
+				  std::size_t{ 1 } );
+
+				auto chunks = std::vector<chunk_t>( );
+				chunks.reserve( chunk_count );
+				CharT *chunk_first = first;
+				for( std::size_t n = 1; n <= chunk_count; ++n ) {
+					CharT *chunk_last =
+					  n == chunk_count
+					    ? last
+					    : ( std::max )( chunk_first,
+					                    first + static_cast<std::ptrdiff_t>(
+					                              size / chunk_count * n ) );
+					// Do not end a range inside of an escape
+					while( chunk_last != last and chunk_last != chunk_first and
+					       chunk_last[-1] == '\\' ) {
+						++chunk_last;
+					}
+					if( chunk_last != chunk_first ) {
+						chunks.push_back( chunk_t{ chunk_first, chunk_last } );
+					}
+					chunk_first = chunk_last;
+				}
+				if( chunks.empty( ) ) {
+					chunks.push_back( chunk_t{ first, last } );
+				}
+
+				if( chunks.size( ) > 1 ) {
+					auto summaries = std::vector<array_range_summary>( chunks.size( ) );
+					run_parallel_tasks( executor, chunks.size( ), [&]( std::size_t n ) {
+						summaries[n] =
+						  summarize_array_range( chunks[n].first, chunks[n].last );
+					} );
+					bool in_string = false;
+					std::ptrdiff_t depth = 1;
+					for( std::size_t n = 0; n < chunks.size( ); ++n ) {
+						chunks[n].in_string = in_string;
+						chunks[n].depth = depth;
+						auto const s = static_cast<std::size_t>( in_string );
+						if( depth + summaries[n].min_depth[s] <= 0 ) {
+							// The array ends in this range, later ranges are not part of it
+							depth = 0;
+							continue;
+						}
+						depth += summaries[n].depth_change[s];
+						in_string = summaries[n].ends_in_string[s];
+					}
+				}
+				run_parallel_tasks( executor, chunks.size( ), [&]( std::size_t n ) {
+					find_array_separators( chunks[n] );
+				} );
+
+				// The opening bracket precedes the first element
+				chunks.front( ).first_separator = open_bracket;
+				++chunks.front( ).count;
+				std::size_t index = 0;
+				for( auto &chunk : chunks ) {
+					chunk.index = index;
+					index += chunk.count;
+				}
+				return chunks;
+			}
+
+			/***
+			 * @brief Parse the elements of chunk into out.  Each is followed by a
+			 * comma or the closing bracket of the array, an element can extend past
+			 * the end of the range
+			 */
+			template<typename JsonElement, typename ParseState, typename OutputIt>
+			void parse_array_chunk( parallel_array_chunk<typename ParseState::CharT> &chunk,
+			                        typename ParseState::CharT *doc_last,
+			                        OutputIt out ) {
+				using element_type = json_deduced_type<JsonElement>;
+				if( chunk.count == 0 ) {
+					return;
+				}
+				auto parse_state = ParseState( chunk.first_separator + 1, doc_last );
+				for( std::size_t n = 0; n < chunk.count; ++n ) {
+					parse_state.trim_left( );
+					daw_json_assert_weak( parse_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+					if( parse_state.front( ) == ']' ) {
+						// An empty array, or a trailing comma
+						daw_json_ensure( n + 1 == chunk.count,
+						                 ErrorReason::InvalidBracketing, parse_state );
+						chunk.end_separator = parse_state.first;
+						return;
+					}
+					*out = parse_value<element_type>(
+					  parse_state, ParseTag<element_type::expected_type>{ } );
+					++out;
+					++chunk.parsed;
+					parse_state.trim_left( );
+					daw_json_assert_weak( parse_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+					chunk.end_separator = parse_state.first;
+					if( parse_state.front( ) == ']' ) {
+						daw_json_ensure( n + 1 == chunk.count,
+						                 ErrorReason::InvalidBracketing, parse_state );
+						return;
+					}
+					daw_json_ensure( parse_state.front( ) == ',',
+					                 ErrorReason::InvalidBracketing, parse_state );
+					parse_state.remove_prefix( );
+				}
+			}
+
+			/***
+			 * @brief Check that the chunks continue one another, each starting at
+			 * the separator the previous one ended at, and that the last element
+			 * is followed by the closing bracket
+			 * @return The position of the closing bracket
+			 */
+			template<typename ParseState>
+			[[nodiscard]] typename ParseState::CharT *verify_array_chunks(
+			  std::vector<parallel_array_chunk<typename ParseState::CharT>> const
+			    &chunks,
+			  ParseState location ) {
+				auto *expected = chunks.front( ).first_separator;
+				for( auto const &chunk : chunks ) {
+					// A range without separators is inside of an element that started
+					// earlier
+					if( chunk.first_separator == nullptr ) {
+						continue;
+					}
+					if( DAW_UNLIKELY( chunk.first_separator != expected ) ) {
+						// Report the earlier of the two, where the structure first differs
+						location.first = ( std::min )( chunk.first_separator, expected );
+						daw_json_error( ErrorReason::InvalidBracketing, location );
+					}
+					if( chunk.count > 0 ) {
+						expected = chunk.end_separator;
+					}
+				}
+				location.first = expected;
+				daw_json_ensure( *expected == ']', ErrorReason::InvalidBracketing,
+				                 location );
+				return expected;
+			}
+		} // namespace json_details
+
+		/***
+		 * @brief Parse JSON data where the root item is an array, decoding the
+		 * elements in parallel.  The array is split into byte ranges, and each
+		 * task finds the elements starting in its range by tracking strings and
+		 * brackets.  The elements are parsed into a presized vector, keeping the
+		 * original order.  Documents that allow comments are parsed on the
+		 * calling thread.  When elements fail to parse, the error of the first
+		 * one in document order is reported
+		 * @tparam JsonElement The type of each element in array.  Its parse_to_t
+		 * must be default constructible and not bool
+		 * @param json_data JSON string data containing array
+		 * @param executor See the Executor description above
+		 * @return A std::vector containing parsed data from JSON string
+		 * @throws daw::json::json_exception
+		 */
+		template<typename JsonElement, typename String, typename Executor,
+		         auto... PolicyFlags>
+		[[nodiscard]] std::vector<json_details::from_json_result_t<JsonElement>>
+		from_json_array_parallel( String &&json_data, Executor &&executor,
+		                          options::parse_flags_t<PolicyFlags...> ) {
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+			static_assert(
+			  json_details::has_unnamed_default_type_mapping_v<JsonElement>,
+			  "Missing specialization of daw::json::json_data_contract for class "
+			  "mapping or specialization of daw::json::json_link_basic_type_map" );
+			using element_type = json_details::json_deduced_type<JsonElement>;
+			static_assert( traits::not_same_v<element_type, void>,
+			               "Unknown JsonElement type." );
+			using value_type = json_details::from_json_result_t<JsonElement>;
+			static_assert( std::is_default_constructible_v<value_type>,
+			               "The result vector is presized, the element type must be "
+			               "default constructible" );
+			static_assert( not std::is_same_v<value_type, bool>,
+			               "Elements are written from several threads, the bit packed "
+			               "std::vector<bool> cannot be used" );
+
+			daw_json_ensure( std::size( json_data ) != 0,
+			                 ErrorReason::EmptyJSONDocument );
+			daw_json_ensure( std::data( json_data ) != nullptr,
+			                 ErrorReason::EmptyJSONPath );
+
+			using ParseState = TryDefaultParsePolicy<
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>>;
+			if constexpr( not std::is_same_v<typename ParseState::CommentPolicy,
+			                                 NoCommentSkippingPolicy> ) {
+				// Comments can hide brackets and quotes from the byte range scans, so
+				// these documents are parsed on the calling thread
+				return from_json_array<JsonElement>(
+				  DAW_FWD( json_data ), options::parse_flags<PolicyFlags...> );
+			} else {
+				auto parse_state =
+				  ParseState{ std::data( json_data ), daw::data_end( json_data ) };
+				auto chunks = json_details::partition_json_array(
+				  parse_state,
+				  json_details::executor_concurrency( executor ) *
+				    json_details::parallel_tasks_per_thread,
+				  executor );
+
+				auto result = std::vector<value_type>( chunks.back( ).index +
+				                                       chunks.back( ).count );
+				auto parse_chunk = [&]( std::size_t n ) {
+					json_details::parse_array_chunk<JsonElement, ParseState>(
+					  chunks[n], parse_state.last,
+					  std::next( result.begin( ),
+					             static_cast<std::ptrdiff_t>( chunks[n].index ) ) );
+				};
+				json_details::run_parallel_tasks( executor, chunks.size( ),
+				                                  parse_chunk );
+				auto *const close_bracket =
+				  json_details::verify_array_chunks( chunks, parse_state );
+				// Only the last separator can be followed by the closing bracket
+				std::size_t parsed = 0;
+				for( auto const &chunk : chunks ) {
+					parsed += chunk.parsed;
+				}
+				result.resize( parsed );
+
+				parse_state.first = close_bracket + 1;
+				if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+					parse_state.trim_left( );
+					daw_json_ensure( parse_state.empty( ),
+					                 ErrorReason::InvalidEndOfValue, parse_state );
+				}
+				return result;
+			}
+		}
+
+		/***
+		 * @brief Parse JSON data where the root item is an array, decoding the
+		 * elements in parallel.  See from_json_array_parallel above
+		 * @tparam JsonElement The type of each element in array
+		 * @param json_data JSON string data containing array
+		 * @param executor See the Executor description above
+		 * @return A std::vector containing parsed data from JSON string
+		 * @throws daw::json::json_exception
+		 */
+		template<typename JsonElement, typename String, typename Executor>
+		[[nodiscard]] std::vector<json_details::from_json_result_t<JsonElement>>
+		from_json_array_parallel( String &&json_data, Executor &&executor ) {
+			return from_json_array_parallel<JsonElement>(
+			  DAW_FWD( json_data ), DAW_FWD( executor ), options::parse_flags<> );
+		}
+
+		/***
+		 * @brief Parse JSON data where the root item is an array, decoding the
+		 * elements in parallel on a json_thread_executor.  See
+		 * from_json_array_parallel above
+		 * @tparam JsonElement The type of each element in array
+		 * @param json_data JSON string data containing array
+		 * @return A std::vector containing parsed data from JSON string
+		 * @throws daw::json::json_exception
+		 */
+		template<typename JsonElement, typename String>
+		[[nodiscard]] std::vector<json_details::from_json_result_t<JsonElement>>
+		from_json_array_parallel( String &&json_data ) {
+			return from_json_array_parallel<JsonElement>(
+			  DAW_FWD( json_data ), json_thread_executor( ),
+			  options::parse_flags<> );
+		}
+
+		/***
+		 * @brief Parse each line of a JSON Lines document in parallel, keeping the
+		 * document order.  The document is split into many small chunks at line
+		 * boundaries, which the executor's threads claim as they finish others.
+		 * When lines fail to parse, the error of the first one in document order
+		 * is reported
+		 * @tparam JsonElement Type of each element in the document
+		 * @tparam PolicyFlags Parse options for the elements
+		 * @param jsonl_doc The JSON Lines document
+		 * @param executor See the Executor description above
+		 * @return A std::vector of the parsed lines
+		 * @throws daw::json::json_exception
+		 */
+		template<typename JsonElement = json_value, auto... PolicyFlags,
+		         typename Executor>
+		[[nodiscard]] std::vector<json_details::from_json_result_t<JsonElement>>
+		parse_jsonl_parallel( daw::string_view jsonl_doc, Executor &&executor ) {
+			using value_type = json_details::from_json_result_t<JsonElement>;
+			auto const parts = partition_jsonl_document<JsonElement, PolicyFlags...>(
+			  json_details::jsonl_chunk_count( executor, jsonl_doc.size( ) ),
+			  jsonl_doc );
+			auto chunk_results = std::vector<std::vector<value_type>>( parts.size( ) );
+			auto parse_chunk = [&]( std::size_t n ) {
+				auto &chunk_result = chunk_results[n];
+				for( auto &&value : parts[n] ) {
+					chunk_result.push_back( DAW_FWD( value ) );
+				}
+			};
+			json_details::run_parallel_tasks( executor, parts.size( ), parse_chunk );
+
+			std::size_t total_size = 0;
+			for( auto const &chunk_result : chunk_results ) {
+				total_size += chunk_result.size( );
+			}
+			auto result = std::vector<value_type>( );
+			result.reserve( total_size );
+			for( auto &chunk_result : chunk_results ) {
+				std::move( chunk_result.begin( ), chunk_result.end( ),
+				           std::back_inserter( result ) );
+			}
+			return result;
+		}
+
+		/***
+		 * @brief Parse each line of a JSON Lines document in parallel on a
+		 * json_thread_executor, keeping the document order.  See
+		 * parse_jsonl_parallel above
+		 * @tparam JsonElement Type of each element in the document
+		 * @tparam PolicyFlags Parse options for the elements
+		 * @param jsonl_doc The JSON Lines document
+		 * @return A std::vector of the parsed lines
+		 * @throws daw::json::json_exception
+		 */
+		template<typename JsonElement = json_value, auto... PolicyFlags>
+		[[nodiscard]] std::vector<json_details::from_json_result_t<JsonElement>>
+		parse_jsonl_parallel( daw::string_view jsonl_doc ) {
+			return parse_jsonl_parallel<JsonElement, PolicyFlags...>(
+			  jsonl_doc, json_thread_executor( ) );
+		}
+
+		/***
+		 * @brief Call func with each parsed line of a JSON Lines document.  Lines
+		 * are parsed in parallel and func is called concurrently, in no
+		 * particular order.  Chunks of lines are claimed dynamically, so uneven
+		 * line sizes do not leave threads idle
+		 * @tparam JsonElement Type of each element in the document
+		 * @tparam PolicyFlags Parse options for the elements
+		 * @param jsonl_doc The JSON Lines document
+		 * @param func Callable taking a parsed element.  It must be safe to call
+		 * from several threads at once
+		 * @param executor See the Executor description above
+		 * @throws daw::json::json_exception
+		 */
+		template<typename JsonElement = json_value, auto... PolicyFlags,
+		         typename Function, typename Executor>
+		void for_each_jsonl_parallel( daw::string_view jsonl_doc, Function &&func,
+		                              Executor &&executor ) {
+			auto const parts = partition_jsonl_document<JsonElement, PolicyFlags...>(
+			  json_details::jsonl_chunk_count( executor, jsonl_doc.size( ) ),
+			  jsonl_doc );
+			auto parse_chunk = [&]( std::size_t n ) {
+				for( auto &&value : parts[n] ) {
+					func( DAW_FWD( value ) );
+				}
+			};
+			json_details::run_parallel_tasks( executor, parts.size( ), parse_chunk );
+		}
+
+		/***
+		 * @brief Call func with each parsed line of a JSON Lines document, in
+		 * parallel on a json_thread_executor.  See for_each_jsonl_parallel above
+		 * @tparam JsonElement Type of each element in the document
+		 * @tparam PolicyFlags Parse options for the elements
+		 * @param jsonl_doc The JSON Lines document
+		 * @param func Callable taking a parsed element.  It must be safe to call
+		 * from several threads at once
+		 * @throws daw::json::json_exception
+		 */
+		template<typename JsonElement = json_value, auto... PolicyFlags,
+		         typename Function>
+		void for_each_jsonl_parallel( daw::string_view jsonl_doc,
+		                              Function &&func ) {
+			for_each_jsonl_parallel<JsonElement, PolicyFlags...>(
+			  jsonl_doc, DAW_FWD( func ), json_thread_executor( ) );
+		}
+
+		/***
+		 * @brief Reduce the parsed lines of a JSON Lines document in parallel.
+		 * Each chunk of lines is reduced, starting from a value initialized T,
+		 * with reduce_op( acc, element ). The chunk results are then combined
+		 * into init, in document order, with combine_op( acc, chunk_acc ).  T{ }
+		 * must be an identity of combine_op, e.g. 0 for +, so that the result
+		 * does not depend on the number of chunks
+		 * @tparam JsonElement Type of each element in the document
+		 * @tparam PolicyFlags Parse options for the elements
+		 * @param jsonl_doc The JSON Lines document
+		 * @param init The initial value of the result, it is combined once
+		 * @param reduce_op Callable returning the new accumulator from an
+		 * accumulator and a parsed element
+		 * @param combine_op Callable returning the combination of two accumulators
+		 * @param executor See the Executor description above
+		 * @return The combined result
+		 * @throws daw::json::json_exception
+		 */
+		template<typename JsonElement = json_value, auto... PolicyFlags,
+		         typename T, typename ReduceOp, typename CombineOp,
+		         typename Executor>
+		[[nodiscard]] T reduce_jsonl_parallel( daw::string_view jsonl_doc, T init,
+		                                       ReduceOp &&reduce_op,
+		                                       CombineOp &&combine_op,
+		                                       Executor &&executor ) {
+			auto const parts = partition_jsonl_document<JsonElement, PolicyFlags...>(
+			  json_details::jsonl_chunk_count( executor, jsonl_doc.size( ) ),
+			  jsonl_doc );
+			auto chunk_results = std::vector<T>( parts.size( ) );
+			auto reduce_chunk = [&]( std::size_t n ) {
+				auto &acc = chunk_results[n];
+				for( auto &&value : parts[n] ) {
+					acc = reduce_op( DAW_MOVE( acc ), DAW_FWD( value ) );
+				}
+			};
+			json_details::run_parallel_tasks( executor, parts.size( ), reduce_chunk );
+			for( auto &chunk_result : chunk_results ) {
+				init = combine_op( DAW_MOVE( init ), DAW_MOVE( chunk_result ) );
+			}
+			return init;
+		}
+
+		/***
+		 * @brief Reduce the parsed lines of a JSON Lines document in parallel on a
+		 * json_thread_executor.  See reduce_jsonl_parallel above
+		 * @tparam JsonElement Type of each element in the document
+		 * @tparam PolicyFlags Parse options for the elements
+		 * @param jsonl_doc The JSON Lines document
+		 * @param init The initial value of the result, it is combined once
+		 * @param reduce_op Callable returning the new accumulator from an
+		 * accumulator and a parsed element
+		 * @param combine_op Callable returning the combination of two accumulators
+		 * @return The combined result
+		 * @throws daw::json::json_exception
+		 */
+		template<typename JsonElement = json_value, auto... PolicyFlags,
+		         typename T, typename ReduceOp, typename CombineOp>
+		[[nodiscard]] T reduce_jsonl_parallel( daw::string_view jsonl_doc, T init,
+		                                       ReduceOp &&reduce_op,
+		                                       CombineOp &&combine_op ) {
+			return reduce_jsonl_parallel<JsonElement, PolicyFlags...>(
+			  jsonl_doc, DAW_MOVE( init ), DAW_FWD( reduce_op ),
+			  DAW_FWD( combine_op ), json_thread_executor( ) );
+		}
+
+		/***
+		 * @brief Serialize a container to a JSON array, serializing the elements
+		 * in parallel.  The container is split into chunks of consecutive
+		 * elements that the executor serializes into their own buffers, which are
+		 * then written to it in order.  The output is the same as to_json_array's
+		 * for the same output flags
+		 * @tparam JsonElement The type of each element.  Defaults to deducing
+		 * based on the value_type of Container
+		 * @param c Container containing data to serialize.  It must be safe to
+		 * read its elements from several threads at once
+		 * @param it Writable output to write the document to
+		 * @param executor See the Executor description above
+		 * @return it as is with ref qual or as a value if rvalue ref
+		 */
+		template<typename JsonElement = use_default, typename Container,
+		         typename WritableType, typename Executor, auto... PolicyFlags,
+		         std::enable_if_t<concepts::is_writable_output_type_v<
+		                            daw::remove_cvref_t<WritableType>>,
+		                          std::nullptr_t> = nullptr>
+		daw::rvalue_to_value_t<WritableType> to_json_array_parallel(
+		  Container const &c, WritableType &&it, Executor &&executor,
+		  options::output_flags_t<PolicyFlags...> flgs = options::output_flags<> ) {
+			static_assert(
+			  traits::is_container_like_v<daw::remove_cvref_t<Container>>,
+			  "Supplied container must support begin( )/end( )" );
+			using output_t = daw::rvalue_to_value_t<WritableType>;
+
+			if constexpr( std::is_pointer_v<daw::remove_cvref_t<output_t>> ) {
+				daw_json_ensure( it != nullptr, ErrorReason::InvalidNull );
+			}
+			auto const element_count = static_cast<std::size_t>(
+			  std::distance( std::begin( c ), std::end( c ) ) );
+			auto const chunk_count = ( std::min )(
+			  json_details::executor_concurrency( executor ) *
+			    json_details::parallel_tasks_per_thread,
+			  element_count / json_details::parallel_serialize_min_chunk_size );
+			if( chunk_count <= 1 ) {
+				return to_json_array<JsonElement>( c, DAW_FWD( it ), flgs );
+			}
+
+			auto out_it = [&] {
+				if constexpr( is_serialization_policy_v<
+				                daw::remove_cvref_t<WritableType>> ) {
+					if constexpr( sizeof...( PolicyFlags ) == 0 ) {
+						return it;
+					} else {
+						return serialization_policy<typename output_t::iterator_type,
+						                            json_details::serialization::set_bits(
+						                              output_t::policy_flags( ),
+						                              PolicyFlags... )>( it.get( ) );
+					}
+				} else {
+					return serialization_policy<
+					  daw::remove_cvref_t<WritableType>,
+					  options::output_flags_t<PolicyFlags...>::value>( it );
+				}
+			}( );
+			// The chunks are serialized with the flags of the output
+			constexpr json_options_t serialization_flags =
+			  DAW_TYPEOF( out_it )::policy_flags( );
+
+			// Balance the chunk sizes, the first element_count % chunk_count chunks
+			// have one more element
+			using iterator_t = DAW_TYPEOF( std::begin( c ) );
+			auto chunk_firsts = std::vector<iterator_t>( );
+			chunk_firsts.reserve( chunk_count );
+			auto const chunk_size = element_count / chunk_count;
+			auto const chunk_extra = element_count % chunk_count;
+			auto const count_of = [&]( std::size_t n ) {
+				return chunk_size + ( n < chunk_extra ? 1 : 0 );
+			};
+			auto first = std::begin( c );
+			for( std::size_t n = 0; n < chunk_count; ++n ) {
+				chunk_firsts.push_back( first );
+				std::advance( first, static_cast<std::ptrdiff_t>( count_of( n ) ) );
+			}
+
+			auto buffers = std::vector<std::string>( chunk_count );
+			auto serialize_chunk = [&]( std::size_t n ) {
+				json_details::serialize_array_chunk<JsonElement, serialization_flags>(
+				  buffers[n], chunk_firsts[n], count_of( n ), n + 1 == chunk_count );
+			};
+			json_details::run_parallel_tasks( executor, chunk_count,
+			                                  serialize_chunk );
+
+			out_it.put( '[' );
+			for( auto const &buffer : buffers ) {
+				out_it.write( buffer );
+			}
+			out_it.output_newline( );
+			out_it.put( ']' );
+			return out_it.get( );
+		}
+
+		/***
+		 * @brief Serialize a container to a JSON array, serializing the elements
+		 * in parallel.  See to_json_array_parallel above
+		 * @tparam JsonElement The type of each element.  Defaults to deducing
+		 * based on the value_type of Container
+		 * @param c Container containing data to serialize
+		 * @param executor See the Executor description above
+		 * @return A std::string containing the serialized elements of c
+		 */
+		template<typename JsonElement = use_default, typename Container,
+		         typename Executor, auto... PolicyFlags,
+		         std::enable_if_t<not concepts::is_writable_output_type_v<
+		                            daw::remove_cvref_t<Executor>>,
+		                          std::nullptr_t> = nullptr>
+		[[nodiscard]] std::string to_json_array_parallel(
+		  Container const &c, Executor &&executor,
+		  options::output_flags_t<PolicyFlags...> flgs = options::output_flags<> ) {
+			auto result = std::string( );
+			(void)to_json_array_parallel<JsonElement>( c, result, DAW_FWD( executor ),
+			                                           flgs );
+			return result;
+		}
+
+		/***
+		 * @brief Serialize a container to a JSON array, serializing the elements
+		 * in parallel on a json_thread_executor.  See to_json_array_parallel
+		 * above
+		 * @tparam JsonElement The type of each element.  Defaults to deducing
+		 * based on the value_type of Container
+		 * @param c Container containing data to serialize
+		 * @return A std::string containing the serialized elements of c
+		 */
+		template<typename JsonElement = use_default, typename Container>
+		[[nodiscard]] std::string to_json_array_parallel( Container const &c ) {
+			return to_json_array_parallel<JsonElement>( c, json_thread_executor( ),
+			                                            options::output_flags<> );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
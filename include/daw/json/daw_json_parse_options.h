@@ -19,7 +19,8 @@ namespace daw::json {
 				/// @brief Allow for different optimizations.  Currently only the
 				/// compile_time path is fully supported. The others may offer faster
 				/// parsing. The default is compile_time, it provides constexpr parsing
-				/// and generally is faster currently.
+				/// and generally is faster currently.  simd and avx2 fall back to the
+				/// previous mode when DAW_ALLOW_SSE42/DAW_ALLOW_AVX2 are not defined.
 				///
 				/// default: compile_time
 				///
@@ -30,7 +31,10 @@ namespace daw::json {
 					/// methods
 					runtime,
 					/// @brief *testing* Allow code paths that use SIMD intrinsics
-					simd
+					simd,
+					/// @brief *testing* Allow code paths that use 32 byte AVX2
+					/// intrinsics.  The host must support AVX2
+					avx2
 				}; // 2bits
 
 				///
@@ -94,6 +98,8 @@ namespace daw::json {
 				///@brief Use precise IEEE754 parsing of real numbers.  The default is
 				/// no,
 				/// and results is much faster parsing with very small errors of 0-2ulp.
+				/// float and double use the Eisel-Lemire algorithm and only fall back
+				/// to strtod/from_chars for long significands that it cannot round.
 				///
 				/// default: no
 				///
@@ -152,6 +158,33 @@ namespace daw::json {
 				/// default: no
 				///
 				enum class ExcludeSpecialEscapes : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief Learn the order that members of each mapped class arrive in,
+				/// per thread, and check each member name against the predicted member
+				/// before hashing it.  Once a document had its members in a different
+				/// order than the json_member_list, the following ones are parsed in
+				/// document order into temporaries instead of skipping members and
+				/// parsing them later.  This helps when documents consistently order
+				/// members differently from the json_member_list, e.g. a JSON Lines
+				/// stream from a single producer.  It cannot be used in constant
+				/// expressions
+				///
+				/// default: no
+				///
+				enum class PredictMemberOrder : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief Count the elements of each array and json_key_value before
+				/// parsing them so that containers constructible from (first, last,
+				/// count), like std::vector and std::unordered_map, are sized once.
+				/// The count is a scan over the structural characters of the value
+				/// and is faster than the reallocations it replaces for large arrays.
+				/// See presized_constructor for enabling this per member
+				///
+				/// default: no
+				///
+				enum class PresizeArrays : unsigned { no, yes }; // 1bit
 			} // namespace parser_options
 		}   // namespace options
 	}     // namespace DAW_JSON_VER
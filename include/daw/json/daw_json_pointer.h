@@ -0,0 +1,306 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_exception.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_name.h"
+#include "impl/daw_json_parse_name.h"
+#include "impl/daw_json_skip.h"
+#include "impl/daw_json_value.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief A reference token of a compiled JSON Pointer.  The name is
+			/// stored unescaped in the text of the pointer.
+			struct json_pointer_segment {
+				static constexpr std::size_t no_index =
+				  ( std::numeric_limits<std::size_t>::max )( );
+
+				std::size_t name_first = 0;
+				std::size_t name_size = 0;
+				/// The array index the token selects, or no_index when it is not a
+				/// valid index
+				std::size_t index = no_index;
+			};
+
+			/// @brief The tokens of a compiled JSON Pointer
+			struct json_pointer_view {
+				json_pointer_segment const *segments = nullptr;
+				std::size_t segment_count = 0;
+				char const *text = nullptr;
+
+				[[nodiscard]] constexpr std::size_t size( ) const {
+					return segment_count;
+				}
+
+				/// @brief The unescaped name of the nth token
+				[[nodiscard]] constexpr daw::string_view name( std::size_t n ) const {
+					return daw::string_view( text + segments[n].name_first,
+					                         segments[n].name_size );
+				}
+
+				/// @brief The array index of the nth token, or
+				/// json_pointer_segment::no_index
+				[[nodiscard]] constexpr std::size_t index( std::size_t n ) const {
+					return segments[n].index;
+				}
+			};
+
+			/// @brief The number of reference tokens in a JSON Pointer
+			[[nodiscard]] constexpr std::size_t
+			json_pointer_segment_count( daw::string_view path ) {
+				std::size_t result = 0;
+				for( char c : path ) {
+					if( c == '/' ) {
+						++result;
+					}
+				}
+				return result;
+			}
+
+			/***
+			 * Split a RFC 6901 JSON Pointer into its reference tokens
+			 * @param path The JSON Pointer, e.g. "/statuses/0/user/id"
+			 * @param text Receives the unescaped tokens, needs path.size( ) chars
+			 * @param segments Receives the tokens, needs
+			 * json_pointer_segment_count( path ) elements
+			 */
+			constexpr void compile_json_pointer( daw::string_view path, char *text,
+			                                     json_pointer_segment *segments ) {
+				char const *const ptr = std::data( path );
+				std::size_t const sz = std::size( path );
+				daw_json_ensure( sz == 0 or ptr[0] == '/',
+				                 ErrorReason::InvalidJSONPath );
+				constexpr std::size_t max_index =
+				  ( json_pointer_segment::no_index - 9U ) / 10U;
+				std::size_t out = 0;
+				std::size_t n = 0;
+				while( n < sz ) {
+					++n;
+					auto &segment = *segments++;
+					segment.name_first = out;
+					// Array indices are digits without a leading zero
+					bool is_index = n < sz and ptr[n] != '/' and
+					                not( ptr[n] == '0' and n + 1 < sz and
+					                     ptr[n + 1] != '/' );
+					std::size_t index = 0;
+					for( ; n < sz and ptr[n] != '/'; ++n ) {
+						char c = ptr[n];
+						if( c == '~' ) {
+							daw_json_ensure( n + 1 < sz and
+							                   ( ptr[n + 1] == '0' or ptr[n + 1] == '1' ),
+							                 ErrorReason::InvalidJSONPath );
+							++n;
+							c = ptr[n] == '0' ? '~' : '/';
+							is_index = false;
+						}
+						text[out++] = c;
+						if( is_index and c >= '0' and c <= '9' and index <= max_index ) {
+							index = index * 10U + static_cast<std::size_t>( c - '0' );
+						} else {
+							is_index = false;
+						}
+					}
+					segment.name_size = out - segment.name_first;
+					segment.index = is_index ? index : json_pointer_segment::no_index;
+				}
+			}
+
+			/***
+			 * Move parse_state from the start of a class or array to the start of
+			 * the member named name, or the element at index.  Other members and
+			 * elements are passed over with skip_value without being parsed
+			 * @return true if the member/element exists
+			 */
+			template<typename ParseState>
+			[[nodiscard]] constexpr bool
+			find_json_pointer_segment( ParseState &parse_state,
+			                           daw::string_view name, std::size_t index ) {
+				if( not parse_state.has_more( ) ) {
+					return false;
+				}
+				switch( parse_state.front( ) ) {
+				case '{':
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+					while( parse_state.is_quotes_checked( ) ) {
+						if( parse_name( parse_state ) == name ) {
+							return true;
+						}
+						(void)skip_value( parse_state );
+						parse_state.move_next_member_or_end( );
+					}
+					return false;
+				case '[':
+					if( index == json_pointer_segment::no_index ) {
+						return false;
+					}
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+					while( parse_state.has_more( ) and parse_state.front( ) != ']' ) {
+						if( index == 0 ) {
+							return true;
+						}
+						--index;
+						(void)skip_value( parse_state );
+						parse_state.move_next_member_or_end( );
+					}
+					return false;
+				default:
+					return false;
+				}
+			}
+
+			template<json_options_t PolicyFlags, typename Allocator>
+			[[nodiscard]] constexpr basic_json_value<PolicyFlags, Allocator>
+			find_json_pointer( json_pointer_view pointer,
+			                   basic_json_value<PolicyFlags, Allocator> const &jv ) {
+				auto parse_state = jv.get_raw_state( );
+				for( std::size_t n = 0; n < pointer.size( ); ++n ) {
+					if( not find_json_pointer_segment( parse_state, pointer.name( n ),
+					                                   pointer.index( n ) ) ) {
+						return basic_json_value<PolicyFlags, Allocator>( );
+					}
+				}
+				return basic_json_value<PolicyFlags, Allocator>( parse_state );
+			}
+		} // namespace json_details
+
+		/// @brief A JSON Pointer(RFC 6901) that has been split into reference
+		/// tokens, with escapes and array indices decoded, at compile time.  Use
+		/// json_pointer<Path> to create one.
+		/// @tparam TextSize Size of the pointer text
+		/// @tparam SegmentCount The number of reference tokens
+		template<std::size_t TextSize, std::size_t SegmentCount>
+		class static_json_pointer {
+			// Zero sized arrays are not allowed
+			char m_text[TextSize + 1]{ };
+			json_details::json_pointer_segment m_segments[SegmentCount + 1]{ };
+
+		public:
+			explicit constexpr static_json_pointer( daw::string_view path ) {
+				json_details::compile_json_pointer( path, m_text, m_segments );
+			}
+
+			/// @brief The number of reference tokens
+			[[nodiscard]] static constexpr std::size_t size( ) {
+				return SegmentCount;
+			}
+
+			[[nodiscard]] constexpr json_details::json_pointer_segment const &
+			segment( std::size_t n ) const {
+				return m_segments[n];
+			}
+
+			[[nodiscard]] constexpr daw::string_view segment_name(
+			  json_details::json_pointer_segment const &segment ) const {
+				return daw::string_view( m_text + segment.name_first,
+				                         segment.name_size );
+			}
+
+			[[nodiscard]] constexpr json_details::json_pointer_view view( ) const {
+				return { m_segments, SegmentCount, m_text };
+			}
+
+			/// @brief Find the value the pointer refers to, starting at jv
+			/// @return The value or an empty basic_json_value
+			template<json_options_t PolicyFlags, typename Allocator>
+			[[nodiscard]] constexpr basic_json_value<PolicyFlags, Allocator>
+			find( basic_json_value<PolicyFlags, Allocator> const &jv ) const {
+				return json_details::find_json_pointer( view( ), jv );
+			}
+
+			/// @brief Find the value the pointer refers to in json_doc
+			/// @return The value or an empty json_value
+			[[nodiscard]] constexpr json_value
+			find( daw::string_view json_doc ) const {
+				return find( json_value( json_doc ) );
+			}
+		};
+
+		/// @brief A JSON Pointer(RFC 6901) that has been split into reference
+		/// tokens, with escapes and array indices decoded, once at runtime.  Keep
+		/// it to look up the same path in many documents.
+		class runtime_json_pointer {
+			std::string m_text;
+			std::vector<json_details::json_pointer_segment> m_segments;
+
+		public:
+			/// @throws daw::json::json_exception with ErrorReason::InvalidJSONPath
+			/// when path is not a valid JSON Pointer
+			explicit runtime_json_pointer( daw::string_view path )
+			  : m_text( std::size( path ), '\0' )
+			  , m_segments( json_details::json_pointer_segment_count( path ) ) {
+				json_details::compile_json_pointer( path, m_text.data( ),
+				                                    m_segments.data( ) );
+			}
+
+			/// @brief The number of reference tokens
+			[[nodiscard]] std::size_t size( ) const {
+				return m_segments.size( );
+			}
+
+			[[nodiscard]] json_details::json_pointer_segment const &
+			segment( std::size_t n ) const {
+				return m_segments[n];
+			}
+
+			[[nodiscard]] daw::string_view segment_name(
+			  json_details::json_pointer_segment const &segment ) const {
+				return daw::string_view( m_text.data( ) + segment.name_first,
+				                         segment.name_size );
+			}
+
+			[[nodiscard]] json_details::json_pointer_view view( ) const {
+				return { m_segments.data( ), m_segments.size( ), m_text.data( ) };
+			}
+
+			/// @brief Find the value the pointer refers to, starting at jv
+			/// @return The value or an empty basic_json_value
+			template<json_options_t PolicyFlags, typename Allocator>
+			[[nodiscard]] basic_json_value<PolicyFlags, Allocator>
+			find( basic_json_value<PolicyFlags, Allocator> const &jv ) const {
+				return json_details::find_json_pointer( view( ), jv );
+			}
+
+			/// @brief Find the value the pointer refers to in json_doc
+			/// @return The value or an empty json_value
+			[[nodiscard]] json_value find( daw::string_view json_doc ) const {
+				return find( json_value( json_doc ) );
+			}
+		};
+
+		namespace json_details {
+			template<JSONNAMETYPE Path>
+			constexpr auto make_json_pointer( ) {
+				constexpr auto path = daw::string_view( Path );
+				return static_json_pointer<std::size( path ),
+				                           json_pointer_segment_count( path )>( path );
+			}
+		} // namespace json_details
+
+		/// @brief A JSON Pointer compiled at compile time, e.g.
+		/// json_pointer<"/statuses/0/user/id">.find( json_doc ).  Prior to C++20,
+		/// Path is a static constexpr char const array
+		template<JSONNAMETYPE Path>
+		inline constexpr auto json_pointer =
+		  json_details::make_json_pointer<Path>( );
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
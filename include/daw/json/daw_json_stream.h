@@ -0,0 +1,435 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_json_parse_options.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/daw_move.h>
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <istream>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+#if __has_include( <unistd.h> )
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief Reads up to size bytes into the buffer and returns the number
+		/// read.  Returning 0 signals the end of the input
+		using json_stream_source = std::function<std::size_t( char *, std::size_t )>;
+
+		/// @brief The initial size of the window that streamed input is parsed
+		/// from
+		inline constexpr std::size_t json_stream_default_window_size =
+		  1024U * 1024U;
+
+		/// @brief A json_stream_source reading from is
+		inline json_stream_source json_source_from_istream( std::istream &is ) {
+			return [&is]( char *buffer, std::size_t size ) {
+				is.read( buffer, static_cast<std::streamsize>( size ) );
+				auto const count = static_cast<std::size_t>( is.gcount( ) );
+				if( count == 0 ) {
+					daw_json_ensure( not is.bad( ), ErrorReason::InputError );
+				}
+				return count;
+			};
+		}
+
+		/// @brief A json_stream_source reading from f.  f is not closed
+		inline json_stream_source json_source_from_file( std::FILE *f ) {
+			daw_json_ensure( f != nullptr, ErrorReason::InputError );
+			return [f]( char *buffer, std::size_t size ) {
+				auto const count = std::fread( buffer, 1, size, f );
+				if( count == 0 ) {
+					daw_json_ensure( std::ferror( f ) == 0, ErrorReason::InputError );
+				}
+				return count;
+			};
+		}
+
+#if __has_include( <unistd.h> )
+		/// @brief A json_stream_source reading from the POSIX file descriptor fd,
+		/// e.g. a pipe or socket.  fd is not closed
+		inline json_stream_source json_source_from_fd( int fd ) {
+			return [fd]( char *buffer, std::size_t size ) {
+				while( true ) {
+					auto const count = ::read( fd, buffer, size );
+					if( count >= 0 ) {
+						return static_cast<std::size_t>( count );
+					}
+					daw_json_ensure( errno == EINTR, ErrorReason::InputError );
+				}
+			};
+		}
+#endif
+
+		namespace json_details {
+			/***
+			 * @brief A window over the unconsumed part of streamed input.  Refilling
+			 * moves the unconsumed data to the front of the window and reads after
+			 * it.  The window only grows when it is full of unconsumed data, so the
+			 * memory used is bounded by the larger of the initial size and the
+			 * largest element
+			 */
+			class json_stream_window {
+				json_stream_source m_source;
+				std::vector<char> m_buffer;
+				std::size_t m_first = 0;
+				std::size_t m_last = 0;
+				bool m_is_eof = false;
+
+			public:
+				explicit json_stream_window( json_stream_source source,
+				                             std::size_t window_size )
+				  : m_source( DAW_MOVE( source ) )
+				  , m_buffer( window_size == 0 ? 1 : window_size ) {}
+
+				[[nodiscard]] char const *data( ) const {
+					return m_buffer.data( ) + m_first;
+				}
+
+				[[nodiscard]] std::size_t size( ) const {
+					return m_last - m_first;
+				}
+
+				void consume( std::size_t count ) {
+					m_first += count;
+				}
+
+				/// @brief Read more input.  Offsets from data( ) stay valid, pointers
+				/// do not
+				/// @return false at the end of the input
+				bool refill( ) {
+					if( m_is_eof ) {
+						return false;
+					}
+					if( m_first > 0 ) {
+						std::memmove( m_buffer.data( ), m_buffer.data( ) + m_first,
+						              size( ) );
+						m_last -= m_first;
+						m_first = 0;
+					}
+					if( m_last == m_buffer.size( ) ) {
+						m_buffer.resize( m_buffer.size( ) * 2U );
+					}
+					auto const count =
+					  m_source( m_buffer.data( ) + m_last, m_buffer.size( ) - m_last );
+					if( count == 0 ) {
+						m_is_eof = true;
+						return false;
+					}
+					m_last += count;
+					return true;
+				}
+			};
+
+			constexpr bool is_stream_space( char c ) {
+				return c == ' ' or c == '\t' or c == '\n' or c == '\r';
+			}
+
+			/// @brief Splits streamed input into JSON Lines records, skipping blank
+			/// lines
+			class json_lines_stream_splitter {
+				std::size_t m_scanned = 0;
+
+				static bool is_blank( daw::string_view line ) {
+					for( char c : line ) {
+						if( not is_stream_space( c ) ) {
+							return false;
+						}
+					}
+					return true;
+				}
+
+			public:
+				std::optional<daw::string_view> next( json_stream_window &window ) {
+					while( true ) {
+						auto const *nl = static_cast<char const *>(
+						  std::memchr( window.data( ) + m_scanned, '\n',
+						               window.size( ) - m_scanned ) );
+						std::size_t line_size = 0;
+						std::size_t consumed = 0;
+						if( nl != nullptr ) {
+							line_size = static_cast<std::size_t>( nl - window.data( ) );
+							consumed = line_size + 1U;
+						} else {
+							m_scanned = window.size( );
+							if( window.refill( ) ) {
+								continue;
+							}
+							if( window.size( ) == 0 ) {
+								return std::nullopt;
+							}
+							// The last line does not need a trailing newline
+							line_size = window.size( );
+							consumed = line_size;
+						}
+						auto const line = daw::string_view( window.data( ), line_size );
+						window.consume( consumed );
+						m_scanned = 0;
+						if( not is_blank( line ) ) {
+							return line;
+						}
+					}
+				}
+			};
+
+			/// @brief Splits streamed input into the elements of a top level JSON
+			/// array.  Only the structure needed to find the end of each element
+			/// is checked, the elements are checked when parsed
+			class json_array_stream_splitter {
+				enum class states { before_array, first_element, next_element, done };
+				states m_state = states::before_array;
+
+				/// @return false at the end of input
+				static bool skip_space( json_stream_window &window ) {
+					while( true ) {
+						while( window.size( ) > 0 and is_stream_space( *window.data( ) ) ) {
+							window.consume( 1 );
+						}
+						if( window.size( ) > 0 ) {
+							return true;
+						}
+						if( not window.refill( ) ) {
+							return false;
+						}
+					}
+				}
+
+				/// @return The size of the value at the front of the window
+				static std::size_t find_value_end( json_stream_window &window ) {
+					std::size_t pos = 0;
+					std::size_t depth = 0;
+					bool in_string = false;
+					bool is_escaped = false;
+					while( true ) {
+						auto const *first = window.data( );
+						auto const size = window.size( );
+						for( ; pos < size; ++pos ) {
+							char const c = first[pos];
+							if( in_string ) {
+								if( is_escaped ) {
+									is_escaped = false;
+								} else if( c == '\\' ) {
+									is_escaped = true;
+								} else if( c == '"' ) {
+									in_string = false;
+									if( depth == 0 ) {
+										return pos + 1;
+									}
+								}
+								continue;
+							}
+							switch( c ) {
+							case '"':
+								in_string = true;
+								break;
+							case '[':
+							case '{':
+								++depth;
+								break;
+							case ']':
+							case '}':
+								if( depth == 0 ) {
+									return pos;
+								}
+								if( --depth == 0 ) {
+									return pos + 1;
+								}
+								break;
+							case ',':
+								if( depth == 0 ) {
+									return pos;
+								}
+								break;
+							default:
+								if( depth == 0 and is_stream_space( c ) ) {
+									return pos;
+								}
+							}
+						}
+						if( not window.refill( ) ) {
+							daw_json_ensure( depth == 0 and not in_string,
+							                 ErrorReason::UnexpectedEndOfData );
+							return pos;
+						}
+					}
+				}
+
+			public:
+				std::optional<daw::string_view> next( json_stream_window &window ) {
+					switch( m_state ) {
+					case states::done:
+						return std::nullopt;
+					case states::before_array:
+						daw_json_ensure( skip_space( window ) and *window.data( ) == '[',
+						                 ErrorReason::InvalidArrayStart );
+						window.consume( 1 );
+						m_state = states::first_element;
+						daw_json_ensure( skip_space( window ),
+						                 ErrorReason::UnexpectedEndOfData );
+						break;
+					case states::first_element:
+						break;
+					case states::next_element:
+						daw_json_ensure( skip_space( window ),
+						                 ErrorReason::UnexpectedEndOfData );
+						if( *window.data( ) == ',' ) {
+							window.consume( 1 );
+							daw_json_ensure( skip_space( window ),
+							                 ErrorReason::UnexpectedEndOfData );
+							daw_json_ensure( *window.data( ) != ']',
+							                 ErrorReason::TrailingComma );
+						} else {
+							daw_json_ensure( *window.data( ) == ']',
+							                 ErrorReason::InvalidEndOfValue );
+						}
+						break;
+					}
+					if( *window.data( ) == ']' ) {
+						window.consume( 1 );
+						m_state = states::done;
+						return std::nullopt;
+					}
+					auto const value_size = find_value_end( window );
+					daw_json_ensure( value_size > 0, ErrorReason::InvalidStartOfValue );
+					auto const value = daw::string_view( window.data( ), value_size );
+					window.consume( value_size );
+					m_state = states::next_element;
+					return value;
+				}
+			};
+		} // namespace json_details
+
+		/***
+		 * @brief Parse the elements of streamed JSON input one at a time, while
+		 * only keeping a window of the input in memory.  Each element, and any
+		 * string_view or json_value parsed from it, is only valid until the next
+		 * element is read
+		 * @tparam Splitter Finds the elements in the window
+		 * @tparam JsonElement Type of each element
+		 * @tparam PolicyFlags Parse options for the elements
+		 */
+		template<typename Splitter, typename JsonElement, auto... PolicyFlags>
+		class basic_json_stream {
+			json_details::json_stream_window m_window;
+			Splitter m_splitter{ };
+
+		public:
+			using value_type = json_details::from_json_result_t<JsonElement>;
+
+			explicit basic_json_stream(
+			  json_stream_source source,
+			  std::size_t window_size = json_stream_default_window_size )
+			  : m_window( DAW_MOVE( source ), window_size ) {}
+
+			/// @brief The JSON text of the next element
+			/// @return std::nullopt at the end of the input
+			[[nodiscard]] std::optional<daw::string_view> next_raw( ) {
+				return m_splitter.next( m_window );
+			}
+
+			/// @brief Parse the next element
+			/// @return std::nullopt at the end of the input
+			/// @throws daw::json::json_exception
+			[[nodiscard]] std::optional<value_type> next( ) {
+				auto const raw = next_raw( );
+				if( not raw ) {
+					return std::nullopt;
+				}
+				return from_json<JsonElement>( *raw,
+				                               options::parse_flags<PolicyFlags...> );
+			}
+
+			/// @brief An input iterator over the parsed elements
+			class iterator {
+				basic_json_stream *m_stream = nullptr;
+				std::optional<value_type> m_value{ };
+
+			public:
+				using value_type = typename basic_json_stream::value_type;
+				using reference = value_type &;
+				using pointer = value_type *;
+				using difference_type = std::ptrdiff_t;
+				using iterator_category = std::input_iterator_tag;
+
+				iterator( ) = default;
+
+				explicit iterator( basic_json_stream &stream )
+				  : m_stream( &stream ) {
+					operator++( );
+				}
+
+				[[nodiscard]] reference operator*( ) {
+					return *m_value;
+				}
+
+				[[nodiscard]] pointer operator->( ) {
+					return &*m_value;
+				}
+
+				iterator &operator++( ) {
+					m_value = m_stream->next( );
+					if( not m_value ) {
+						m_stream = nullptr;
+					}
+					return *this;
+				}
+
+				void operator++( int ) {
+					(void)operator++( );
+				}
+
+				[[nodiscard]] bool operator==( iterator const &rhs ) const {
+					return m_stream == rhs.m_stream;
+				}
+
+				[[nodiscard]] bool operator!=( iterator const &rhs ) const {
+					return m_stream != rhs.m_stream;
+				}
+			};
+
+			/// @brief Start reading elements.  Can only be called once
+			[[nodiscard]] iterator begin( ) {
+				return iterator( *this );
+			}
+
+			[[nodiscard]] iterator end( ) {
+				return iterator( );
+			}
+		};
+
+		/// @brief Parse the elements of a top level JSON array from streamed
+		/// input.  See basic_json_stream
+		template<typename JsonElement = json_value, auto... PolicyFlags>
+		using json_array_stream =
+		  basic_json_stream<json_details::json_array_stream_splitter, JsonElement,
+		                    PolicyFlags...>;
+
+		/// @brief Parse the records of JSON Lines from streamed input.  See
+		/// basic_json_stream
+		template<typename JsonElement = json_value, auto... PolicyFlags>
+		using json_lines_stream =
+		  basic_json_stream<json_details::json_lines_stream_splitter, JsonElement,
+		                    PolicyFlags...>;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
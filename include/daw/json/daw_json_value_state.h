@@ -11,6 +11,7 @@
 #include "impl/version.h"
 
 #include "impl/daw_json_arrow_proxy.h"
+#include "impl/daw_json_location_info.h"
 #include "impl/daw_json_parse_class.h"
 #include "impl/daw_json_parse_name.h"
 #include "impl/daw_json_value.h"
@@ -20,7 +21,9 @@
 #include <daw/daw_string_view.h>
 #include <daw/daw_uint_buffer.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -28,6 +31,10 @@
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
 		namespace json_details {
+			/// basic_stateful_json_value searches classes with fewer members than
+			/// this linearly, without a hash index
+			inline constexpr std::size_t stateful_hash_index_min_members = 16;
+
 			template<json_options_t PolicyFlags = json_details::default_policy_flag,
 			         typename Allocator = json_details::NoAllocator>
 			class basic_stateful_json_value_state {
@@ -71,7 +78,7 @@ namespace daw::json {
 
 		/**
 		 * Maintains the parse positions of a json_value so that you pay the lookup
-		 * costs once
+		 * costs once.  The members of large classes are found by name hash
 		 * @tparam ParseState see IteratorRange
 		 */
 		template<json_options_t PolicyFlags = json_details::default_policy_flag,
@@ -83,41 +90,124 @@ namespace daw::json {
 			std::vector<
 			  json_details::basic_stateful_json_value_state<PolicyFlags, Allocator>>
 			  m_locs{ };
+			// Open addressing index of the class members in m_locs by name hash.
+			// A slot holds the position in m_locs + 1, or 0 when empty.  It is
+			// built when m_locs reaches stateful_hash_index_min_members
+			std::vector<std::uint32_t> m_slots{ };
+			// Set when every member/element is in m_locs
+			bool m_is_complete = false;
+
+			[[nodiscard]] static constexpr std::size_t
+			first_slot( daw::UInt32 hash, std::size_t slot_count ) {
+				return static_cast<std::size_t>(
+				         json_details::perfect_hash_details::fmix32(
+				           static_cast<std::uint32_t>( hash ) ) ) &
+				       ( slot_count - 1U );
+			}
+
+			constexpr void add_slot( std::size_t pos ) {
+				auto const mask = std::size( m_slots ) - 1U;
+				auto slot = first_slot( m_locs[pos].hash_value, std::size( m_slots ) );
+				while( m_slots[slot] != 0 ) {
+					slot = ( slot + 1U ) & mask;
+				}
+				m_slots[slot] = static_cast<std::uint32_t>( pos + 1U );
+			}
+
+			constexpr void rebuild_slots( std::size_t slot_count ) {
+				m_slots.assign( slot_count, 0 );
+				for( std::size_t pos = 0; pos < std::size( m_locs ); ++pos ) {
+					add_slot( pos );
+				}
+			}
 
 			/***
-			 * Move parser until member name matches key if needed
-			 * @param member to move_to
+			 * Record the location of the next member/element, keeping the slots at
+			 * most half full
+			 */
+			constexpr void
+			add_location( daw::string_view name,
+			              basic_json_value_iterator<PolicyFlags, Allocator> it ) {
+				m_locs.emplace_back( name, DAW_MOVE( it ) );
+				auto const count = std::size( m_locs );
+				if( not m_slots.empty( ) ) {
+					if( count * 2U > std::size( m_slots ) ) {
+						rebuild_slots( std::size( m_slots ) * 2U );
+					} else {
+						add_slot( count - 1U );
+					}
+				} else if( count >= json_details::stateful_hash_index_min_members and
+				           m_value.is_class( ) ) {
+					rebuild_slots(
+					  json_details::perfect_hash_details::pow2_ceil( count * 2U ) );
+				}
+			}
+
+			/***
+			 * The location after the last one found
+			 */
+			[[nodiscard]] constexpr basic_json_value_iterator<PolicyFlags, Allocator>
+			next_location( ) const {
+				if( m_locs.empty( ) ) {
+					return m_value.begin( );
+				}
+				auto res = m_locs.back( ).location;
+				++res;
+				return res;
+			}
+
+			/***
+			 * Find a member in the locations found so far
 			 * @return position of member or size
 			 */
-			[[nodiscard]] constexpr std::size_t move_to( json_member_name member ) {
-				std::size_t pos = 0;
-				std::size_t const Sz = std::size( m_locs );
-				for( ; pos < Sz; ++pos ) {
+			[[nodiscard]] constexpr std::size_t
+			find_location( json_member_name member ) const {
+				if( m_slots.empty( ) ) {
+					std::size_t pos = 0;
+					std::size_t const Sz = std::size( m_locs );
+					for( ; pos < Sz; ++pos ) {
+						if( m_locs[pos].is_match( member.name, member.hash_value ) ) {
+							return pos;
+						}
+					}
+					return Sz;
+				}
+				auto const mask = std::size( m_slots ) - 1U;
+				auto slot = first_slot( member.hash_value, std::size( m_slots ) );
+				while( m_slots[slot] != 0 ) {
+					auto const pos = static_cast<std::size_t>( m_slots[slot] - 1U );
 					if( m_locs[pos].is_match( member.name, member.hash_value ) ) {
 						return pos;
 					}
+					slot = ( slot + 1U ) & mask;
 				}
+				return std::size( m_locs );
+			}
 
-				auto it = [&] {
-					if( m_locs.empty( ) ) {
-						return m_value.begin( );
-					}
-					auto res = m_locs.back( ).location;
-					++res;
-					return res;
-				}( );
+			/***
+			 * Move parser until member name matches key if needed
+			 * @param member to move_to
+			 * @return position of member or size
+			 */
+			[[nodiscard]] constexpr std::size_t move_to( json_member_name member ) {
+				if( std::size_t const pos = find_location( member );
+				    pos < std::size( m_locs ) or m_is_complete ) {
+					return pos;
+				}
+
+				auto it = next_location( );
 				auto const last = m_value.end( );
 				while( it != last ) {
 					auto name = it.name( );
 					daw_json_assert_weak( name, ErrorReason::MissingMemberName );
-					auto const &new_loc = m_locs.emplace_back(
+					add_location(
 					  daw::string_view( std::data( *name ), std::size( *name ) ), it );
-					if( new_loc.is_match( member.name ) ) {
-						return pos;
+					if( m_locs.back( ).is_match( member.name, member.hash_value ) ) {
+						return std::size( m_locs ) - 1U;
 					}
-					++pos;
 					++it;
 				}
+				m_is_complete = true;
 				return std::size( m_locs );
 			}
 
@@ -127,26 +217,19 @@ namespace daw::json {
 			 * @return position in members or size
 			 */
 			[[nodiscard]] constexpr std::size_t move_to( std::size_t index ) {
-				if( index < std::size( m_locs ) ) {
-					return index;
+				if( index < std::size( m_locs ) or m_is_complete ) {
+					return ( std::min )( index, std::size( m_locs ) );
 				}
-				auto it = [&] {
-					if( m_locs.empty( ) ) {
-						return m_value.begin( );
-					}
-					auto res = m_locs.back( ).location;
-					++res;
-					return res;
-				}( );
+				auto it = next_location( );
 				auto last = m_value.end( );
 				std::size_t pos = std::size( m_locs );
 				while( it != last ) {
 					auto name = it.name( );
 					if( name ) {
-						m_locs.emplace_back(
+						add_location(
 						  daw::string_view( std::data( *name ), std::size( *name ) ), it );
 					} else {
-						m_locs.emplace_back( daw::string_view( ), it );
+						add_location( daw::string_view( ), it );
 					}
 					if( pos == index ) {
 						return pos;
@@ -154,6 +237,7 @@ namespace daw::json {
 					++pos;
 					++it;
 				}
+				m_is_complete = true;
 				return std::size( m_locs );
 			}
 
@@ -185,6 +269,8 @@ namespace daw::json {
 			constexpr void reset( basic_json_value<PolicyFlags, Allocator> val ) {
 				m_value = DAW_MOVE( val );
 				m_locs.clear( );
+				m_slots.clear( );
+				m_is_complete = false;
 			}
 
 			/// @brief Create a basic_json_member for the named member
@@ -277,7 +363,7 @@ namespace daw::json {
 			 * @return true if the member/element is present
 			 */
 			[[nodiscard]] constexpr bool contains( std::size_t index ) {
-				return move_to( index ) < size( m_locs );
+				return move_to( index ) < std::size( m_locs );
 			}
 
 			/***
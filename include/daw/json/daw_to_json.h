@@ -66,16 +66,52 @@ namespace daw::json {
 			  .get( );
 		}
 
+		/// @brief The exact number of characters to_json will output for value,
+		/// including escapes and formatted numbers.  Nothing is written or
+		/// allocated
+		/// @tparam JsonClass Type that has json_parser_description and to_json_data
+		/// function overloads.  Defaults to deducing based on Value
+		/// @param value value to measure the serialization of
+		/// @return Size of the JSON document in characters
+		template<typename JsonClass = use_default, typename Value,
+		         auto... PolicyFlags>
+		[[nodiscard]] constexpr std::size_t json_serialized_size(
+		  Value const &value,
+		  options::output_flags_t<PolicyFlags...> flgs = options::output_flags<> ) {
+			auto out = json_details::size_counting_output{ };
+			(void)to_json<JsonClass>( value, out, flgs );
+			return out.size;
+		}
+
 		template<typename JsonClass, typename Value, auto... PolicyFlags>
 		inline std::string to_json( Value const &value,
 		                            options::output_flags_t<PolicyFlags...> flgs ) {
 			std::string result{ };
 			result.reserve( 4096 );
-			(void)to_json( value, result, flgs );
+			(void)to_json<JsonClass>( value, result, flgs );
 			result.shrink_to_fit( );
 			return result;
 		}
 
+		/// @brief Serialize a value to a std::string that is allocated once with
+		/// the exact size.  The value is serialized twice, once to measure it, so
+		/// this suits large documents where reallocating and copying the result
+		/// costs more than that
+		/// @tparam JsonClass Type that has json_parser_description and to_json_data
+		/// function overloads.  Defaults to deducing based on Value
+		/// @param value value to serialize
+		/// @return std::string with JSON representation of value
+		template<typename JsonClass = use_default, typename Value,
+		         auto... PolicyFlags>
+		[[nodiscard]] inline std::string to_json_presized(
+		  Value const &value,
+		  options::output_flags_t<PolicyFlags...> flgs = options::output_flags<> ) {
+			std::string result{ };
+			result.reserve( json_serialized_size<JsonClass>( value, flgs ) );
+			(void)to_json<JsonClass>( value, result, flgs );
+			return result;
+		}
+
 		template<typename JsonElement, typename Container, typename WritableType,
 		         auto... PolicyFlags,
 		         std::enable_if_t<concepts::is_writable_output_type_v<
@@ -151,6 +187,22 @@ namespace daw::json {
 			return out_it.get( );
 		}
 
+		/// @brief The exact number of characters to_json_array will output for
+		/// the elements of c.  Nothing is written or allocated
+		/// @tparam JsonElement Type of the elements.  Defaults to deducing based
+		/// on the value_type of Container
+		/// @param c Container to measure the serialization of
+		/// @return Size of the JSON document in characters
+		template<typename JsonElement = use_default, typename Container,
+		         auto... PolicyFlags>
+		[[nodiscard]] constexpr std::size_t json_serialized_array_size(
+		  Container const &c,
+		  options::output_flags_t<PolicyFlags...> flgs = options::output_flags<> ) {
+			auto out = json_details::size_counting_output{ };
+			(void)to_json_array<JsonElement>( c, out, flgs );
+			return out.size;
+		}
+
 		template<typename JsonElement, typename Container, auto... PolicyFlags>
 		inline std::string
 		to_json_array( Container const &c,
@@ -158,9 +210,27 @@ namespace daw::json {
 			static_assert( not std::is_same_v<std::string, JsonElement> );
 			std::string result{ };
 			result.reserve( 4096 );
-			(void)to_json_array( c, result, flgs );
+			(void)to_json_array<JsonElement>( c, result, flgs );
 			result.shrink_to_fit( );
 			return result;
 		}
+
+		/// @brief Serialize a container to a JSON array in a std::string that is
+		/// allocated once with the exact size.  See to_json_presized
+		/// @tparam JsonElement Type of the elements.  Defaults to deducing based
+		/// on the value_type of Container
+		/// @param c Container containing data to serialize.
+		/// @return A std::string containing the serialized elements of c
+		template<typename JsonElement = use_default, typename Container,
+		         auto... PolicyFlags>
+		[[nodiscard]] inline std::string to_json_array_presized(
+		  Container const &c,
+		  options::output_flags_t<PolicyFlags...> flgs = options::output_flags<> ) {
+			static_assert( not std::is_same_v<std::string, JsonElement> );
+			std::string result{ };
+			result.reserve( json_serialized_array_size<JsonElement>( c, flgs ) );
+			(void)to_json_array<JsonElement>( c, result, flgs );
+			return result;
+		}
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
@@ -16,6 +16,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -89,6 +90,58 @@ namespace daw::json {
 				}
 				return first;
 			}
+
+			inline constexpr std::uint64_t powers_of_ten_u64[20] = {
+			  1ULL,
+			  10ULL,
+			  100ULL,
+			  1'000ULL,
+			  10'000ULL,
+			  100'000ULL,
+			  1'000'000ULL,
+			  10'000'000ULL,
+			  100'000'000ULL,
+			  1'000'000'000ULL,
+			  10'000'000'000ULL,
+			  100'000'000'000ULL,
+			  1'000'000'000'000ULL,
+			  10'000'000'000'000ULL,
+			  100'000'000'000'000ULL,
+			  1'000'000'000'000'000ULL,
+			  10'000'000'000'000'000ULL,
+			  100'000'000'000'000'000ULL,
+			  1'000'000'000'000'000'000ULL,
+			  10'000'000'000'000'000'000ULL };
+
+			/// @brief The number of decimal digits in value.  The bit width gives an
+			/// estimate of log10 that is off by at most one, a table lookup then
+			/// corrects it
+			DAW_ATTRIB_INLINE constexpr std::size_t
+			count_decimal_digits( std::uint64_t value ) {
+				// 0 has one digit.  Setting the low bit does not change the count of
+				// any other value as powers of ten above 1 are even
+				value |= 1U;
+				auto const bit_count = static_cast<std::size_t>(
+				  64 - daw::cxmath::count_leading_zeroes( value ) );
+				auto const estimate = ( bit_count * 1233U ) >> 12U;
+				return estimate + 1U - ( value < powers_of_ten_u64[estimate] ? 1U : 0U );
+			}
+
+			/// @brief The number of decimal digits in a non-negative value of an
+			/// integer type wider than 64 bits, such as __int128
+			template<typename Integer,
+			         std::enable_if_t<( sizeof( Integer ) > sizeof( std::uint64_t ) ),
+			                          std::nullptr_t> = nullptr>
+			constexpr std::size_t count_decimal_digits( Integer value ) {
+				constexpr auto ten19 = static_cast<Integer>( powers_of_ten_u64[19] );
+				std::size_t result = 0;
+				while( value > static_cast<Integer>( ~std::uint64_t{ 0 } ) ) {
+					value /= ten19;
+					result += 19;
+				}
+				return result +
+				       count_decimal_digits( static_cast<std::uint64_t>( value ) );
+			}
 		} // namespace json_details
 	}   // namespace DAW_JSON_VER
 } // namespace daw::json
@@ -0,0 +1,71 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#if defined( _MSC_VER ) and not defined( __clang__ ) and \
+  ( defined( _M_X64 ) or defined( _M_IX86 ) )
+#include <intrin.h>
+#endif
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief The instruction set extensions of the host that the SIMD exec
+		/// modes rely on
+		struct cpu_features {
+			bool sse42 = false;
+			bool pclmul = false;
+			bool avx2 = false;
+			bool bmi1 = false;
+		};
+
+		namespace json_details {
+			/// @brief Query the host CPU, including whether the OS saves the AVX
+			/// registers.  Non-x86 hosts report no features
+			inline cpu_features detect_cpu_features( ) {
+				auto result = cpu_features{ };
+#if( defined( __GNUC__ ) or defined( __clang__ ) ) and \
+  ( defined( __x86_64__ ) or defined( __i386__ ) )
+				__builtin_cpu_init( );
+				result.sse42 = __builtin_cpu_supports( "sse4.2" ) != 0;
+				result.pclmul = __builtin_cpu_supports( "pclmul" ) != 0;
+				result.avx2 = __builtin_cpu_supports( "avx2" ) != 0;
+				result.bmi1 = __builtin_cpu_supports( "bmi" ) != 0;
+#elif defined( _MSC_VER ) and ( defined( _M_X64 ) or defined( _M_IX86 ) )
+				int regs[4]{ };
+				__cpuid( regs, 0 );
+				int const max_leaf = regs[0];
+				if( max_leaf < 1 ) {
+					return result;
+				}
+				__cpuid( regs, 1 );
+				result.sse42 = ( regs[2] & ( 1 << 20 ) ) != 0;
+				result.pclmul = ( regs[2] & ( 1 << 1 ) ) != 0;
+				bool const os_saves_ymm =
+				  ( ( regs[2] & ( 1 << 27 ) ) != 0 ) and
+				  ( ( _xgetbv( 0 ) & 0x6U ) == 0x6U ); // OSXSAVE, XMM and YMM state
+				if( max_leaf >= 7 ) {
+					__cpuidex( regs, 7, 0 );
+					result.avx2 = os_saves_ymm and ( ( regs[1] & ( 1 << 5 ) ) != 0 );
+					result.bmi1 = ( regs[1] & ( 1 << 3 ) ) != 0;
+				}
+#endif
+				return result;
+			}
+		} // namespace json_details
+
+		/// @brief The features of the host CPU.  They are detected on first use
+		/// and cached for the life of the program
+		inline cpu_features const &host_cpu_features( ) {
+			static cpu_features const features = json_details::detect_cpu_features( );
+			return features;
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -160,6 +160,21 @@ namespace daw::json {
 					return result;
 				}
 			}
+
+			/// @brief Construct from the range with a capacity of count, where count
+			/// is the number of elements in the range, e.g. from
+			/// options::PresizeArrays or json_sized_array
+			template<typename Iterator>
+			DAW_ATTRIB_INLINE
+			  DAW_JSON_CPP23_STATIC_CALL_OP DAW_JSON_CX_VECTOR std::vector<T, Alloc>
+			  operator( )( Iterator first, Iterator last, std::size_t count,
+			               Alloc const &alloc = Alloc{ } )
+			    DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				auto result = std::vector<T, Alloc>( alloc );
+				result.reserve( count );
+				result.assign_range( json_details::iter_range_t{ first, last } );
+				return result;
+			}
 		};
 
 #else
@@ -196,6 +211,21 @@ namespace daw::json {
 					return result;
 				}
 			}
+
+			/// @brief Construct from the range with a capacity of count, where count
+			/// is the number of elements in the range, e.g. from
+			/// options::PresizeArrays or json_sized_array
+			template<typename Iterator>
+			DAW_ATTRIB_INLINE
+			  DAW_JSON_CPP23_STATIC_CALL_OP DAW_JSON_CX_VECTOR std::vector<T, Alloc>
+			  operator( )( Iterator first, Iterator last, std::size_t count,
+			               Alloc const &alloc = Alloc{ } )
+			    DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				auto result = std::vector<T, Alloc>( alloc );
+				result.reserve( count );
+				result.assign( first, last );
+				return result;
+			}
 		};
 #endif
 
@@ -227,6 +257,33 @@ namespace daw::json {
 				return std::unordered_map<Key, T, Hash, CompareEqual, Alloc>(
 				  first, last, count, Hash{ }, CompareEqual{ }, alloc );
 			}
+
+			/// @brief Construct from the range with enough buckets for element_count
+			/// elements
+			template<typename Iterator>
+			DAW_ATTRIB_INLINE DAW_JSON_CPP23_STATIC_CALL_OP
+			  std::unordered_map<Key, T, Hash, CompareEqual, Alloc>
+			  operator( )( Iterator first, Iterator last, std::size_t element_count,
+			               Alloc const &alloc = Alloc{ } )
+			    DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				return std::unordered_map<Key, T, Hash, CompareEqual, Alloc>(
+				  first, last, element_count, Hash{ }, CompareEqual{ }, alloc );
+			}
+		};
+
+		/// @brief A Constructor for json_array/json_key_value members that sizes
+		/// the container before it is filled, as options::PresizeArrays does for
+		/// every member.  When SizeHint is not 0 it is used as the capacity
+		/// instead of counting the elements first
+		/// @tparam Container The container type.  default_constructor<Container>
+		/// must accept (first, last, std::size_t)
+		/// @tparam SizeHint Expected number of elements, or 0 to count them
+		template<typename Container, std::size_t SizeHint = 0>
+		struct presized_constructor : default_constructor<Container> {
+			static constexpr bool presize_container = true;
+			static constexpr std::size_t size_hint = SizeHint;
+
+			using default_constructor<Container>::operator( );
 		};
 
 		/// @brief Default constructor for readable nullable types.
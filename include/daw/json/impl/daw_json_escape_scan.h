@@ -0,0 +1,183 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_cpu_features.h"
+#include "daw_json_exec_modes.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_cpp_feature_check.h>
+
+#if defined( __SSE2__ ) or defined( _M_X64 ) or \
+  ( defined( _M_IX86_FP ) and _M_IX86_FP >= 2 )
+#define DAW_JSON_ESCAPE_SCAN_SSE2
+#include <emmintrin.h>
+#endif
+#if defined( DAW_ALLOW_AVX2 )
+#include <immintrin.h>
+#endif
+#if defined( DAW_HAS_MSVC_LIKE )
+#include <intrin.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief Index of the lowest set bit of a non-zero value
+			DAW_ATTRIB_INLINE std::size_t escape_scan_lsb( std::uint64_t value ) {
+#if DAW_HAS_BUILTIN( __builtin_ctzll )
+				return static_cast<std::size_t>( __builtin_ctzll( value ) );
+#elif defined( DAW_HAS_MSVC_LIKE ) and defined( _M_X64 )
+				unsigned long index;
+				_BitScanForward64( &index, value );
+				return static_cast<std::size_t>( index );
+#else
+				std::size_t result = 0;
+				while( ( value & 1U ) == 0 ) {
+					value >>= 1U;
+					++result;
+				}
+				return result;
+#endif
+			}
+
+			/// @brief Does c need to be escaped when written inside a JSON string.
+			/// Bytes from 0x7F up are only special when restrict_high is set
+			template<bool restrict_high>
+			DAW_ATTRIB_INLINE constexpr bool needs_escape( char c ) {
+				auto const u = static_cast<unsigned char>( c );
+				if constexpr( restrict_high ) {
+					if( u >= 0x7FU ) {
+						return true;
+					}
+				}
+				return u < 0x20U or c == '"' or c == '\\';
+			}
+
+			/// @brief Find the first character in [first, last) that cannot be
+			/// copied as is into a JSON string.  Blocks of 16 bytes are checked at
+			/// once when SSE2 is enabled for the translation unit, 8 at a time
+			/// otherwise.
+			/// @return Pointer to the character or last when there is none
+			template<bool restrict_high>
+			DAW_ATTRIB_INLINE char const *
+			mem_find_escape( runtime_exec_tag, char const *first, char const *last ) {
+#if defined( DAW_JSON_ESCAPE_SCAN_SSE2 )
+				while( last - first >= 16 ) {
+					__m128i const block =
+					  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first ) );
+					__m128i found =
+					  _mm_or_si128( _mm_cmpeq_epi8( block, _mm_set1_epi8( '"' ) ),
+					                _mm_cmpeq_epi8( block, _mm_set1_epi8( '\\' ) ) );
+					found = _mm_or_si128(
+					  found,
+					  _mm_cmpeq_epi8( _mm_min_epu8( block, _mm_set1_epi8( 0x1F ) ),
+					                  block ) );
+					if constexpr( restrict_high ) {
+						found = _mm_or_si128(
+						  found,
+						  _mm_cmpeq_epi8( _mm_max_epu8( block, _mm_set1_epi8( 0x7F ) ),
+						                  block ) );
+					}
+					auto const mask =
+					  static_cast<std::uint32_t>( _mm_movemask_epi8( found ) );
+					if( mask != 0 ) {
+						return first + escape_scan_lsb( mask );
+					}
+					first += 16;
+				}
+#elif( defined( __BYTE_ORDER__ ) and                                           \
+       __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ ) or                           \
+  defined( _WIN32 )
+				// The lowest flagged byte of each of these tests is always a real
+				// match, false positives only show up in the bytes after one
+				constexpr std::uint64_t ones = 0x0101'0101'0101'0101ULL;
+				constexpr std::uint64_t highs = 0x8080'8080'8080'8080ULL;
+				auto const has_zero = []( std::uint64_t v ) {
+					return ( v - ones ) & ~v & highs;
+				};
+				while( last - first >= 8 ) {
+					std::uint64_t v;
+					std::memcpy( &v, first, sizeof( v ) );
+					std::uint64_t found =
+					  has_zero( v ^ ( ones * static_cast<unsigned char>( '"' ) ) ) |
+					  has_zero( v ^ ( ones * static_cast<unsigned char>( '\\' ) ) ) |
+					  ( ( v - ones * 0x20U ) & ~v & highs );
+					if constexpr( restrict_high ) {
+						found |= ( ( v + ones ) | v ) & highs;
+					}
+					if( found != 0 ) {
+						return first + escape_scan_lsb( found ) / 8U;
+					}
+					first += 8;
+				}
+#endif
+				while( first != last and not needs_escape<restrict_high>( *first ) ) {
+					++first;
+				}
+				return first;
+			}
+
+#if defined( DAW_ALLOW_AVX2 )
+			/// @brief mem_find_escape checking 32 bytes at a time.  Only call it when
+			/// the host supports AVX2, see use_avx2_escape_scan
+			template<bool restrict_high>
+			DAW_JSON_AVX2_FN char const *
+			mem_find_escape( avx2_exec_tag, char const *first, char const *last ) {
+				while( last - first >= 32 ) {
+					__m256i const block =
+					  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first ) );
+					__m256i found = _mm256_or_si256(
+					  _mm256_cmpeq_epi8( block, _mm256_set1_epi8( '"' ) ),
+					  _mm256_cmpeq_epi8( block, _mm256_set1_epi8( '\\' ) ) );
+					// block <= 0x1F as unsigned
+					found = _mm256_or_si256(
+					  found,
+					  _mm256_cmpeq_epi8(
+					    _mm256_min_epu8( block, _mm256_set1_epi8( 0x1F ) ), block ) );
+					if constexpr( restrict_high ) {
+						// block >= 0x7F as unsigned
+						found = _mm256_or_si256(
+						  found,
+						  _mm256_cmpeq_epi8(
+						    _mm256_max_epu8( block, _mm256_set1_epi8( 0x7F ) ), block ) );
+					}
+					auto const mask =
+					  static_cast<std::uint32_t>( _mm256_movemask_epi8( found ) );
+					if( mask != 0 ) {
+						return first + escape_scan_lsb( mask );
+					}
+					first += 32;
+				}
+				return mem_find_escape<restrict_high>( runtime_exec_tag{ }, first,
+				                                       last );
+			}
+#endif
+
+			/// @brief Can the serializer use the avx2_exec_tag escape scan.  The
+			/// host is checked once and this is false unless DAW_ALLOW_AVX2 is
+			/// defined
+			inline bool use_avx2_escape_scan( ) {
+#if defined( DAW_ALLOW_AVX2 )
+				static bool const result =
+				  host_cpu_features( ).avx2 and host_cpu_features( ).bmi1;
+				return result;
+#else
+				return false;
+#endif
+			}
+		} // namespace json_details
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -10,15 +10,42 @@
 
 #include "version.h"
 
+#include <daw/daw_attributes.h>
 #include <daw/daw_scope_guard.h>
 
+#include <cstddef>
 #include <string_view>
 
+/// When DAW_ALLOW_SSE42/DAW_ALLOW_AVX2 are defined, the SIMD scanning kernels
+/// are available via the sse42_exec_tag/avx2_exec_tag.  If the translation
+/// unit is not already compiled for that instruction set(e.g. -mavx2 or
+/// -march=haswell), the kernels are compiled with a target attribute so that
+/// the rest of the program stays portable.  It is then up to the caller to only
+/// select them on hosts that support them, see daw_json_exec_dispatch.h
+#if defined( DAW_ALLOW_SSE42 )
+#if( defined( __SSE4_2__ ) and defined( __PCLMUL__ ) ) or \
+  ( defined( _MSC_VER ) and not defined( __clang__ ) )
+#define DAW_JSON_SSE42_FN DAW_ATTRIB_INLINE
+#else
+#define DAW_JSON_SSE42_FN __attribute__( ( target( "sse4.2,pclmul" ) ) ) inline
+#endif
+#endif
+#if defined( DAW_ALLOW_AVX2 )
+#if defined( __AVX2__ ) or ( defined( _MSC_VER ) and not defined( __clang__ ) )
+#define DAW_JSON_AVX2_FN DAW_ATTRIB_INLINE
+#else
+#define DAW_JSON_AVX2_FN __attribute__( ( target( "avx2,bmi" ) ) ) inline
+#endif
+#endif
+
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
 		struct constexpr_exec_tag {
 			static constexpr std::string_view name = "constexpr";
 			static constexpr bool can_constexpr = true;
+			/// The number of bytes processed per step by the vector kernels, 0 when
+			/// there are none
+			static constexpr std::size_t simd_width = 0;
 		};
 		struct runtime_exec_tag : constexpr_exec_tag {
 			static constexpr std::string_view name = "runtime";
@@ -28,10 +55,23 @@ namespace daw::json {
 		struct sse42_exec_tag : runtime_exec_tag {
 			static constexpr std::string_view name = "sse4.2";
 			static constexpr bool can_constexpr = false;
+			static constexpr std::size_t simd_width = 16;
 		};
 		using simd_exec_tag = sse42_exec_tag;
 #else
 		struct simd_exec_tag : runtime_exec_tag {};
+#endif
+#if defined( DAW_ALLOW_AVX2 )
+		/// Uses 32 byte AVX2 kernels for string, structural character, and
+		/// whitespace scanning.  Anything without an AVX2 kernel falls back to the
+		/// simd_exec_tag overloads
+		struct avx2_exec_tag : simd_exec_tag {
+			static constexpr std::string_view name = "avx2";
+			static constexpr bool can_constexpr = false;
+			static constexpr std::size_t simd_width = 32;
+		};
+#else
+		using avx2_exec_tag = simd_exec_tag;
 #endif
 		using default_exec_tag = constexpr_exec_tag;
 	} // namespace DAW_JSON_VER
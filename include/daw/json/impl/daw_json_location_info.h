@@ -24,7 +24,9 @@
 #include <daw/daw_utility.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <type_traits>
 #include <utility>
 
 #if defined( DAW_JSON_PARSER_DIAGNOSTICS )
@@ -97,17 +99,236 @@ namespace daw::json {
 				}
 			};
 
+			/// Classes with fewer members than this use a linear scan of the member
+			/// hashes to find a name, it is as fast as a table lookup at this size
+			inline constexpr std::size_t perfect_name_hash_min_members = 8;
+
+			namespace perfect_hash_details {
+				constexpr std::size_t pow2_ceil( std::size_t v ) {
+					std::size_t result = 1;
+					while( result < v ) {
+						result <<= 1U;
+					}
+					return result;
+				}
+
+				constexpr unsigned log2_pow2( std::size_t v ) {
+					unsigned result = 0;
+					while( ( std::size_t{ 1 } << result ) < v ) {
+						++result;
+					}
+					return result;
+				}
+
+				[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::uint32_t
+				fmix32( std::uint32_t h ) {
+					h ^= h >> 16U;
+					h *= 0x85EB'CA6BU;
+					h ^= h >> 13U;
+					h *= 0xC2B2'AE35U;
+					h ^= h >> 16U;
+					return h;
+				}
+			} // namespace perfect_hash_details
+
+			/***
+			 * A hash and displace perfect hash of the member name hashes of a
+			 * json_class.  Each name hash selects a bucket, and the bucket's
+			 * displacement selects a slot that holds the member index.  Unused slots
+			 * hold MemberCount
+			 * @tparam MemberCount Number of mapped members from json_class
+			 */
+			template<std::size_t MemberCount>
+			struct perfect_name_hash {
+				static constexpr std::size_t slot_count =
+				  perfect_hash_details::pow2_ceil( MemberCount ) * 2;
+				static constexpr std::size_t bucket_count =
+				  slot_count >= 16 ? slot_count / 4 : 2;
+				static constexpr unsigned bucket_shift =
+				  32U - perfect_hash_details::log2_pow2( bucket_count );
+				using index_t = std::conditional_t<( MemberCount < 0xFFU ),
+				                                   std::uint8_t, std::uint16_t>;
+
+				bool is_valid = false;
+				std::uint16_t displacements[bucket_count]{ };
+				index_t slots[slot_count]{ };
+
+				[[nodiscard]] DAW_ATTRIB_INLINE static constexpr std::size_t
+				bucket( std::uint32_t h ) {
+					return static_cast<std::size_t>( ( h * 0x9E37'79B1U ) >>
+					                                 bucket_shift );
+				}
+
+				[[nodiscard]] DAW_ATTRIB_INLINE static constexpr std::size_t
+				slot( std::uint32_t h, std::uint32_t displacement ) {
+					return static_cast<std::size_t>( perfect_hash_details::fmix32(
+					         h + displacement * 0x9E37'79B9U ) ) &
+					       ( slot_count - 1U );
+				}
+
+				/// @brief The only member index that can have the name hash h, or
+				/// MemberCount.  The caller must verify the hash
+				[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t
+				find( std::uint32_t h ) const {
+					return slots[slot( h, displacements[bucket( h )] )];
+				}
+			};
+
+			// Should never be called outside a consteval context
+			template<std::uint32_t... Hashes>
+			constexpr perfect_name_hash<sizeof...( Hashes )> make_perfect_name_hash( ) {
+				constexpr std::size_t member_count = sizeof...( Hashes );
+				using table_t = perfect_name_hash<member_count>;
+				using index_t = typename table_t::index_t;
+				std::uint32_t const hashes[member_count]{ Hashes... };
+				auto result = table_t{ };
+				for( auto &s : result.slots ) {
+					s = static_cast<index_t>( member_count );
+				}
+				// Equal hashes cannot be told apart, use the linear scan
+				for( std::size_t n = 0; n < member_count; ++n ) {
+					for( std::size_t m = n + 1; m < member_count; ++m ) {
+						if( hashes[n] == hashes[m] ) {
+							return result;
+						}
+					}
+				}
+				std::size_t bucket_sizes[table_t::bucket_count]{ };
+				std::size_t max_bucket_size = 0;
+				for( std::uint32_t h : hashes ) {
+					auto const sz = ++bucket_sizes[table_t::bucket( h )];
+					if( sz > max_bucket_size ) {
+						max_bucket_size = sz;
+					}
+				}
+				// Place the largest buckets first, while most slots are free
+				for( std::size_t sz = max_bucket_size; sz > 0; --sz ) {
+					for( std::size_t b = 0; b < table_t::bucket_count; ++b ) {
+						if( bucket_sizes[b] != sz ) {
+							continue;
+						}
+						bool is_placed = false;
+						for( std::uint32_t d = 0; d <= 0xFFFFU and not is_placed; ++d ) {
+							std::size_t used[member_count]{ };
+							std::size_t used_count = 0;
+							bool is_free = true;
+							for( std::size_t n = 0; n < member_count and is_free; ++n ) {
+								if( table_t::bucket( hashes[n] ) != b ) {
+									continue;
+								}
+								auto const s = table_t::slot( hashes[n], d );
+								is_free = result.slots[s] == member_count;
+								for( std::size_t u = 0; u < used_count and is_free; ++u ) {
+									is_free = used[u] != s;
+								}
+								used[used_count++] = s;
+							}
+							if( not is_free ) {
+								continue;
+							}
+							for( std::size_t n = 0; n < member_count; ++n ) {
+								if( table_t::bucket( hashes[n] ) == b ) {
+									result.slots[table_t::slot( hashes[n], d )] =
+									  static_cast<index_t>( n );
+								}
+							}
+							result.displacements[b] = static_cast<std::uint16_t>( d );
+							is_placed = true;
+						}
+						if( not is_placed ) {
+							return result;
+						}
+					}
+				}
+				result.is_valid = true;
+				return result;
+			}
+
+			template<std::uint32_t... Hashes>
+			inline constexpr auto perfect_name_hash_v =
+			  make_perfect_name_hash<Hashes...>( );
+
+			/***
+			 * The member name lookup of a json_class.  Classes that are too small,
+			 * or whose name hashes collide, use a linear scan of the hashes
+			 * @tparam Hashes name_hash of each member name, in member order
+			 */
+			template<std::uint32_t... Hashes>
+			struct member_name_index {
+				static constexpr bool has_perfect_hash( ) {
+					if constexpr( sizeof...( Hashes ) < perfect_name_hash_min_members ) {
+						return false;
+					} else {
+						return perfect_name_hash_v<Hashes...>.is_valid;
+					}
+				}
+				static constexpr bool is_perfect_hash = has_perfect_hash( );
+
+				[[nodiscard]] DAW_ATTRIB_INLINE static constexpr std::size_t
+				find( UInt32 h ) {
+					return perfect_name_hash_v<Hashes...>.find(
+					  static_cast<std::uint32_t>( h ) );
+				}
+			};
+
+			/// Used when options::PredictMemberOrder is not enabled
+			struct no_member_order_prediction {};
+
+			/***
+			 * The order that the members of T arrived in for the last document
+			 * parsed on this thread.  See options::PredictMemberOrder
+			 * @tparam T The mapped type, each has its own cache
+			 * @tparam JsonMembers The members mapped in the json_class of T
+			 */
+			template<typename T, typename... JsonMembers>
+			struct member_order_prediction {
+				static constexpr std::size_t member_count = sizeof...( JsonMembers );
+				/// Documents can have unmapped members, leave room for some of them
+				static constexpr std::size_t capacity = member_count * 2;
+				using index_t = std::conditional_t<( capacity < 0xFFU ), std::uint8_t,
+				                                   std::uint16_t>;
+
+				static constexpr daw::string_view names[member_count] = {
+				  daw::string_view( JsonMembers::name )... };
+
+				/// The member index + 1 of the n'th key in the document, or 0 when
+				/// nothing has been learned.  An unmapped key is stored as
+				/// member_count + 1
+				static inline thread_local index_t order[capacity] = { };
+
+				/// The last document had members in a different order than the member
+				/// list, so the next one is parsed in document order
+				static inline thread_local bool out_of_order = false;
+			};
+
+			/// The number of keys looked up so far in the class being parsed, used
+			/// to index the predicted order.  Empty when member order prediction is
+			/// not enabled
+			template<typename Prediction>
+			struct member_key_counter {
+				std::size_t key_count = 0;
+			};
+
+			template<>
+			struct member_key_counter<no_member_order_prediction> {};
+
 			/***
 			 * Contains an array of member location_info mapped in a json_class
 			 * @tparam MemberCount Number of mapped members from json_class
+			 * @tparam NameIndex member_name_index of the member names
+			 * @tparam Prediction member_order_prediction of the class, or
+			 * no_member_order_prediction
 			 */
 			template<std::size_t MemberCount, typename CharT,
-			         bool DoFullNameMatch = true>
-			struct locations_info_t {
+			         bool DoFullNameMatch = true,
+			         typename NameIndex = member_name_index<>,
+			         typename Prediction = no_member_order_prediction>
+			struct locations_info_t : member_key_counter<Prediction> {
 				using value_type = location_info_t<DoFullNameMatch, CharT>;
 				using reference = value_type &;
 				using const_reference = value_type const &;
 				static constexpr bool do_full_name_match = DoFullNameMatch;
+				using prediction_t = Prediction;
 				daw::UInt32 hashes[MemberCount];
 				value_type names[MemberCount];
 
@@ -132,10 +353,28 @@ namespace daw::json {
 					UInt32 const hash = name_hash<expect_long_strings>( key );
 #if defined( DAW_JSON_BUGFIX_MSVC_EVAL_ORDER_002 )
 					(void)start_pos;
-					for( std::size_t n = 0; n < MemberCount; ++n ) {
+					constexpr std::size_t first_pos = 0;
 #else
-					for( std::size_t n = start_pos; n < MemberCount; ++n ) {
+					constexpr std::size_t first_pos = start_pos;
 #endif
+					if constexpr( NameIndex::is_perfect_hash ) {
+						// Members usually arrive in order, so try the expected one before
+						// the table
+						std::size_t n = start_pos;
+						if( hashes[n] != hash ) {
+							n = NameIndex::find( hash );
+							if( n >= MemberCount or n < first_pos or hashes[n] != hash ) {
+								return MemberCount;
+							}
+						}
+						if constexpr( do_full_name_match ) {
+							if( DAW_UNLIKELY( key != names[n].name ) ) {
+								return MemberCount;
+							}
+						}
+						return n;
+					}
+					for( std::size_t n = first_pos; n < MemberCount; ++n ) {
 						if( hashes[n] == hash ) {
 							if constexpr( do_full_name_match ) {
 								if( DAW_UNLIKELY( key != names[n].name ) ) {
@@ -147,6 +386,34 @@ namespace daw::json {
 					}
 					return MemberCount;
 				}
+
+				/// @brief find_name, but check the member predicted from the previous
+				/// documents first.  Not usable in constant expressions
+				template<bool expect_long_strings, std::size_t start_pos>
+				[[nodiscard]] DAW_ATTRIB_INLINE std::size_t
+				find_name_predicted( daw::template_vals_t<start_pos> sp,
+				                     daw::string_view key ) {
+					static_assert(
+					  not std::is_same_v<Prediction, no_member_order_prediction> );
+					std::size_t const ordinal = this->key_count++;
+					if( DAW_UNLIKELY( ordinal >= Prediction::capacity ) ) {
+						return find_name<expect_long_strings>( sp, key );
+					}
+					auto &order = Prediction::order[ordinal];
+					std::size_t const predicted = static_cast<std::size_t>( order ) - 1U;
+					if( predicted < MemberCount and
+					    DAW_LIKELY( Prediction::names[predicted] == key ) ) {
+#if defined( DAW_JSON_BUGFIX_MSVC_EVAL_ORDER_002 )
+						return predicted;
+#else
+						// Members before start_pos have already been found
+						return predicted >= start_pos ? predicted : MemberCount;
+#endif
+					}
+					std::size_t const result = find_name<expect_long_strings>( sp, key );
+					order = static_cast<typename Prediction::index_t>( result + 1U );
+					return result;
+				}
 			};
 
 			// Should never be called outside a consteval context
@@ -164,14 +431,22 @@ namespace daw::json {
 			}
 
 			// Should never be called outside a consteval context
-			template<typename ParseState, typename... JsonMembers>
+			template<typename ParseState, typename T, typename... JsonMembers>
 			DAW_ATTRIB_FLATINLINE static inline DAW_JSON_MAKE_LOC_INFO_CONSTEVAL auto
 			make_locations_info( ) {
 				using CharT = typename ParseState::CharT;
+				using prediction_t =
+				  std::conditional_t<ParseState::predict_member_order,
+				                     member_order_prediction<T, JsonMembers...>,
+				                     no_member_order_prediction>;
+				using name_index_t = member_name_index<static_cast<std::uint32_t>(
+				  daw::name_hash<false>( JsonMembers::name ) )...>;
 #if defined( DAW_JSON_ALWAYS_FULL_NAME_MATCH )
 				constexpr bool do_full_name_match = true;
 				return locations_info_t<sizeof...( JsonMembers ), CharT,
-				                        do_full_name_match>{
+				                        do_full_name_match, name_index_t,
+				                        prediction_t>{
+				  { },
 				  { daw::name_hash<false>( JsonMembers::name )... },
 				  { location_info_t<do_full_name_match, CharT>{
 				    JsonMembers::name }... } };
@@ -182,14 +457,17 @@ namespace daw::json {
 				  do_hashes_collide<JsonMembers...>( );
 				if constexpr( do_full_name_match ) {
 					return locations_info_t<sizeof...( JsonMembers ), CharT,
-					                        do_full_name_match>{
+					                        do_full_name_match, name_index_t,
+					                        prediction_t>{
+					  { },
 					  { daw::name_hash<false>( JsonMembers::name )... },
 					  { location_info_t<do_full_name_match, CharT>{
 					    JsonMembers::name }... } };
 				} else {
 					return locations_info_t<sizeof...( JsonMembers ), CharT,
-					                        do_full_name_match>{
-					  { daw::name_hash<false>( JsonMembers::name )... }, {} };
+					                        do_full_name_match, name_index_t,
+					                        prediction_t>{
+					  { }, { daw::name_hash<false>( JsonMembers::name )... }, {} };
 				}
 #endif
 			}
@@ -206,11 +484,13 @@ namespace daw::json {
 			enum class AllMembersMustExist { yes, no };
 			template<std::size_t pos, AllMembersMustExist must_exist,
 			         bool from_start = false, std::size_t N, typename ParseState,
-			         bool B, typename CharT>
+			         bool B, typename CharT, typename NameIndex,
+			         typename Prediction>
 			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr std::pair<ParseState,
 			                                                           bool>
 			find_class_member( ParseState &parse_state,
-			                   locations_info_t<N, CharT, B> &locations,
+			                   locations_info_t<N, CharT, B, NameIndex, Prediction>
+			                     &locations,
 			                   bool is_nullable, daw::string_view member_name ) {
 
 				// silencing gcc9 warning as these are selectively used
@@ -229,9 +509,17 @@ namespace daw::json {
 					// TODO: fully unescape name
 					// parse_name checks if we have more and are quotes
 					auto const name = parse_name( parse_state );
-					auto const name_pos =
-					  locations.template find_name<ParseState::expect_long_strings>(
-					    template_vals<( from_start ? 0 : pos )>, name );
+					auto const name_pos = [&] {
+						if constexpr( ParseState::predict_member_order ) {
+							return locations
+							  .template find_name_predicted<ParseState::expect_long_strings>(
+							    template_vals<( from_start ? 0 : pos )>, name );
+						} else {
+							return locations
+							  .template find_name<ParseState::expect_long_strings>(
+							    template_vals<( from_start ? 0 : pos )>, name );
+						}
+					}( );
 					if constexpr( must_exist == AllMembersMustExist::yes ) {
 						daw_json_assert_weak( name_pos < std::size( locations ),
 						                      ErrorReason::UnknownMember, parse_state );
@@ -267,7 +555,12 @@ namespace daw::json {
 						// RESULT: storing preparsed is slower, don't try 3 times
 						// it also limits the type of things we can parse potentially
 						// Using locations to switch on BaseType is slower too
+						// With member order prediction, the next document is parsed in
+						// document order instead, see parse_json_class
 						locations[name_pos].set_range( skip_value( parse_state ) );
+						if constexpr( ParseState::predict_member_order ) {
+							Prediction::out_of_order = true;
+						}
 
 						if constexpr( ParseState::is_unchecked_input ) {
 							if( name_pos + 1 < std::size( locations ) ) {
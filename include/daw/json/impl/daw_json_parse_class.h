@@ -26,7 +26,10 @@
 
 #include <cstddef>
 #include <exception>
+#include <optional>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -95,10 +98,12 @@ namespace daw::json {
 			///
 			template<std::size_t member_position, typename JsonMember,
 			         AllMembersMustExist must_exist, bool NeedsClassPositions,
-			         typename ParseState, std::size_t N, typename CharT, bool B>
+			         typename ParseState, std::size_t N, typename CharT, bool B,
+			         typename NameIndex, typename Prediction>
 			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr json_result<JsonMember>
-			parse_class_member( ParseState &parse_state,
-			                    locations_info_t<N, CharT, B> &locations ) {
+			parse_class_member(
+			  ParseState &parse_state,
+			  locations_info_t<N, CharT, B, NameIndex, Prediction> &locations ) {
 				parse_state.move_next_member_or_end( );
 
 				daw_json_assert_weak( parse_state.is_at_next_class_member( ),
@@ -173,6 +178,117 @@ namespace daw::json {
 				parse_state.set_class_position( old_class_pos );
 			}
 
+			/// Classes whose members can be parsed in document order into
+			/// temporaries when member order prediction learned that documents
+			/// order them differently from the member list
+			template<typename ParseState, bool NeedsClassPositions,
+			         typename... JsonMembers>
+			inline constexpr bool can_parse_in_document_order_v =
+			  ParseState::predict_member_order and not NeedsClassPositions and
+			  not ParseState::has_allocator and
+			  ( std::is_move_constructible_v<json_result<JsonMembers>> and ... );
+
+			template<typename JsonMember, typename ParseState>
+			DAW_ATTRIB_INLINE static void parse_member_in_document_order(
+			  ParseState &parse_state,
+			  std::optional<json_result<JsonMember>> &value ) {
+				if( DAW_UNLIKELY( value.has_value( ) ) ) {
+					// As when parsing in member list order, the first of duplicate
+					// members is used
+					(void)skip_value( parse_state );
+					return;
+				}
+				value.emplace( parse_value<without_name<JsonMember>>(
+				  parse_state, ParseTag<JsonMember::expected_type>{ } ) );
+			}
+
+			template<typename JsonMember, typename ParseState>
+			[[nodiscard]] DAW_ATTRIB_INLINE static json_result<JsonMember>
+			take_member_in_document_order(
+			  ParseState &parse_state,
+			  std::optional<json_result<JsonMember>> &value ) {
+				if( DAW_LIKELY( value.has_value( ) ) ) {
+					return std::move( *value );
+				}
+				if constexpr( is_json_nullable_v<JsonMember> ) {
+					auto loc = ParseState{ };
+					return parse_value_null<without_name<JsonMember>, true>( loc );
+				} else {
+					daw_json_error( missing_member( std::string_view(
+					                  std::data( JsonMember::name ),
+					                  std::size( JsonMember::name ) ) ),
+					                parse_state );
+				}
+			}
+
+			///
+			/// @brief Parse the members of a class in the order the document has
+			/// them, into temporaries, and construct the class from those.  Out of
+			/// order members are not skipped and parsed again later, this is used
+			/// when member order prediction learned that documents order the
+			/// members differently from the member list.  parse_state is after the
+			/// opening brace
+			///
+			template<typename JsonClass, typename... JsonMembers, typename ParseState,
+			         typename Locations, typename OldClassPos, std::size_t... Is>
+			[[nodiscard]] static json_result<JsonClass>
+			parse_json_class_in_document_order( ParseState &parse_state,
+			                                    Locations &locations,
+			                                    OldClassPos const &old_class_pos,
+			                                    std::index_sequence<Is...> ) {
+				using T = typename JsonClass::parse_to_t;
+				using Constructor = typename JsonClass::constructor_t;
+				constexpr bool must_exist =
+				  json_details::all_json_members_must_exist_v<T, ParseState>;
+
+				auto values = std::tuple<std::optional<json_result<JsonMembers>>...>{ };
+				bool in_order = true;
+				std::size_t previous_pos = 0;
+				while( true ) {
+					parse_state.move_next_member_or_end( );
+					daw_json_assert_weak( parse_state.is_at_next_class_member( ),
+					                      ErrorReason::MissingMemberNameOrEndOfClass,
+					                      parse_state );
+					if( parse_state.front( ) == '}' ) {
+						break;
+					}
+					auto const name = parse_name( parse_state );
+					std::size_t const name_pos =
+					  locations
+					    .template find_name_predicted<ParseState::expect_long_strings>(
+					      template_vals<0>, name );
+					if( name_pos >= sizeof...( JsonMembers ) ) {
+						daw_json_assert_weak( not must_exist, ErrorReason::UnknownMember,
+						                      parse_state );
+						(void)skip_value( parse_state );
+						continue;
+					}
+					in_order = in_order and name_pos >= previous_pos;
+					previous_pos = name_pos;
+					(void)( ( name_pos == Is and
+					          ( parse_member_in_document_order<JsonMembers>(
+					              parse_state, std::get<Is>( values ) ),
+					            true ) ) or
+					        ... );
+				}
+				// An in order document goes back to parsing in member list order
+				Locations::prediction_t::out_of_order = not in_order;
+
+				if constexpr( should_construct_explicitly_v<Constructor, T,
+				                                            ParseState> ) {
+					auto result = T{ take_member_in_document_order<JsonMembers>(
+					  parse_state, std::get<Is>( values ) )... };
+					class_cleanup_now<must_exist>( parse_state, old_class_pos );
+					return result;
+				} else {
+					auto result = construct_value_tp<T, Constructor>(
+					  parse_state, fwd_pack{ take_member_in_document_order<JsonMembers>(
+					                 parse_state, std::get<Is>( values ) )... } );
+					class_cleanup_now<must_exist>( parse_state, old_class_pos );
+					return result;
+				}
+			}
+
 			///
 			/// @brief Parse to the user supplied class.  The parser will run
 			/// left->right if it can when the JSON document's order matches that of
@@ -222,12 +338,26 @@ namespace daw::json {
 
 #if defined( DAW_JSON_BUGFIX_MSVC_KNOWN_LOC_ICE_003 )
 					auto known_locations =
-					  make_locations_info<ParseState, JsonMembers...>( );
+					  make_locations_info<ParseState, T, JsonMembers...>( );
 #else
 					auto known_locations = DAW_AS_CONSTANT(
-					  ( make_locations_info<ParseState, JsonMembers...>( ) ) );
+					  ( make_locations_info<ParseState, T, JsonMembers...>( ) ) );
 #endif
 
+					if constexpr( not is_pinned_type_v<typename JsonClass::parse_to_t> and
+					              can_parse_in_document_order_v<
+					                ParseState, NeedClassPositions::value,
+					                JsonMembers...> ) {
+						using prediction_t =
+						  typename decltype( known_locations )::prediction_t;
+						if( prediction_t::out_of_order ) {
+							return parse_json_class_in_document_order<JsonClass,
+							                                          JsonMembers...>(
+							  parse_state, known_locations, old_class_pos,
+							  std::index_sequence<Is...>{ } );
+						}
+					}
+
 					if constexpr( is_pinned_type_v<typename JsonClass::parse_to_t> ) {
 						/// Because the return type is pinned(no copy/move).  We cannot rely
 						/// on NRVO. This requires on_exit_success that on some platforms
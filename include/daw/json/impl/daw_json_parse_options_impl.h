@@ -35,6 +35,8 @@ namespace daw::json {
 					return "runtime";
 				case ExecModeTypes::simd:
 					return "simd";
+				case ExecModeTypes::avx2:
+					return "avx2";
 				}
 				DAW_UNREACHABLE( );
 			}
@@ -158,13 +160,31 @@ namespace daw::json {
 			  default_json_option_value<options::ExcludeSpecialEscapes> =
 			    options::ExcludeSpecialEscapes::no;
 
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::PredictMemberOrder> = 1;
+
+			template<>
+			inline constexpr auto
+			  default_json_option_value<options::PredictMemberOrder> =
+			    options::PredictMemberOrder::no;
+
+			template<>
+			inline constexpr unsigned json_option_bits_width<options::PresizeArrays> =
+			  1;
+
+			template<>
+			inline constexpr auto default_json_option_value<options::PresizeArrays> =
+			  options::PresizeArrays::no;
+
 			using policy_list = typename option_list_impl<
 			  options::ExecModeTypes, options::ZeroTerminatedString,
 			  options::PolicyCommentTypes, options::CheckedParseMode,
 			  options::AllowEscapedNames, options::IEEE754Precise,
 			  options::ForceFullNameCheck, options::MinifiedDocument,
 			  options::UseExactMappingsByDefault, options::MustVerifyEndOfDataIsValid,
-			  options::ExcludeSpecialEscapes, options::ExpectLongNames>::type;
+			  options::ExcludeSpecialEscapes, options::ExpectLongNames,
+			  options::PredictMemberOrder, options::PresizeArrays>::type;
 
 			template<typename Policy, typename Policies>
 			inline constexpr unsigned basic_policy_bits_start =
@@ -82,7 +82,8 @@ namespace daw::json {
 			using exec_tag_t =
 			  switch_t<json_details::get_bits_for<options::ExecModeTypes,
 			                                      std::size_t>( PolicyFlags ),
-			           constexpr_exec_tag, runtime_exec_tag, simd_exec_tag>;
+			           constexpr_exec_tag, runtime_exec_tag, simd_exec_tag,
+			           avx2_exec_tag>;
 
 			static constexpr exec_tag_t exec_tag = exec_tag_t{ };
 
@@ -151,6 +152,14 @@ namespace daw::json {
 			  json_details::get_bits_for<options::ExpectLongNames>( PolicyFlags ) ==
 			  options::ExpectLongNames::yes;
 
+			static constexpr bool predict_member_order =
+			  json_details::get_bits_for<options::PredictMemberOrder>( PolicyFlags ) ==
+			  options::PredictMemberOrder::yes;
+
+			static constexpr bool presize_arrays =
+			  json_details::get_bits_for<options::PresizeArrays>( PolicyFlags ) ==
+			  options::PresizeArrays::yes;
+
 			using CommentPolicy =
 			  switch_t<json_details::get_bits_for<options::PolicyCommentTypes,
 			                                      std::size_t>( PolicyFlags ),
@@ -13,6 +13,7 @@
 #include "daw_json_assert.h"
 #include "daw_json_parse_common.h"
 #include "daw_json_parse_policy_policy_details.h"
+#include "daw_json_string_util.h"
 #include "daw_not_const_ex_functions.h"
 
 #include <daw/daw_attributes.h>
@@ -103,8 +104,15 @@ namespace daw::json {
 			DAW_ATTRIB_FLATINLINE static constexpr void
 			trim_left_checked( ParseState &parse_state ) {
 				skip_comments_checked( parse_state );
+				using exec_tag_t = typename ParseState::exec_tag_t;
 				while( parse_state.has_more( ) and parse_state.is_space_unchecked( ) ) {
-					parse_state.remove_prefix( );
+					if constexpr( exec_tag_t::simd_width > 0 ) {
+						parse_state.first =
+						  json_details::mem_skip_whitespace_run<exec_tag_t>(
+						    parse_state.first, parse_state.last );
+					} else {
+						parse_state.remove_prefix( );
+					}
 					skip_comments_checked( parse_state );
 				}
 			}
@@ -113,8 +121,14 @@ namespace daw::json {
 			DAW_ATTRIB_FLATINLINE static constexpr void
 			trim_left_unchecked( ParseState &parse_state ) {
 				skip_comments_unchecked( parse_state );
-				while( parse_state.is_space_unchecked( ) ) {
-					parse_state.remove_prefix( );
+				using exec_tag_t = typename ParseState::exec_tag_t;
+				if constexpr( exec_tag_t::simd_width > 0 ) {
+					parse_state.first = json_details::mem_skip_whitespace_run<exec_tag_t>(
+					  parse_state.first, parse_state.last );
+				} else {
+					while( parse_state.is_space_unchecked( ) ) {
+						parse_state.remove_prefix( );
+					}
 				}
 			}
 
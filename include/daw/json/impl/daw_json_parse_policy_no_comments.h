@@ -35,7 +35,15 @@ namespace daw::json {
 					return;
 				} else {
 					using CharT = typename ParseState::CharT;
-					// SIMD here was much slower, most JSON has very minimal whitespace
+					using exec_tag_t = typename ParseState::exec_tag_t;
+					if constexpr( exec_tag_t::simd_width > 0 ) {
+						// Most JSON has very minimal whitespace, the vector kernel is only
+						// used for longer runs
+						parse_state.first =
+						  json_details::mem_skip_whitespace_run<exec_tag_t>(
+						    parse_state.first, parse_state.last );
+						return;
+					}
 					CharT *first = parse_state.first;
 					CharT *const last = parse_state.last;
 
@@ -69,6 +77,13 @@ namespace daw::json {
 					return;
 				} else {
 					using CharT = typename ParseState::CharT;
+					using exec_tag_t = typename ParseState::exec_tag_t;
+					if constexpr( exec_tag_t::simd_width > 0 ) {
+						parse_state.first =
+						  json_details::mem_skip_whitespace_run<exec_tag_t>(
+						    parse_state.first, parse_state.last );
+						return;
+					}
 					CharT *first = parse_state.first;
 					while( DAW_UNLIKELY(
 					  ( static_cast<unsigned>( static_cast<unsigned char>( *first ) ) -
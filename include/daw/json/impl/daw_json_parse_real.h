@@ -12,6 +12,7 @@
 
 #include "daw_fp_fallback.h"
 #include "daw_json_assert.h"
+#include "daw_json_eisel_lemire.h"
 #include "daw_json_parse_policy_policy_details.h"
 #include "daw_json_parse_real_power10.h"
 #include "daw_json_parse_unsigned_int.h"
@@ -37,6 +38,14 @@ namespace daw::json {
 			                         char const *const DAW_RESTRICT last,
 			                         Unsigned &DAW_RESTRICT v ) {
 				Unsigned value = v;
+				if constexpr( std::is_same_v<Unsigned, std::uint64_t> ) {
+					// [first, last) is all digits, take them 8 at a time
+					while( last - first >= 8 ) {
+						value = value * 100'000'000ULL +
+						        static_cast<std::uint64_t>( parse_8_digits( first ) );
+						first += 8;
+					}
+				}
 				if constexpr( skip_end_check ) {
 					auto dig = parse_digit( *first );
 					while( dig < 10U ) {
@@ -66,6 +75,15 @@ namespace daw::json {
 				(void)last;
 
 				Unsigned value = v;
+				if constexpr( std::is_same_v<Unsigned, std::uint64_t> ) {
+					// Long runs of digits, like the fractions of coordinates, are taken 8
+					// at a time
+					while( last - first >= 8 and is_made_of_eight_digits_cx( first ) ) {
+						value = value * 100'000'000ULL +
+						        static_cast<std::uint64_t>( parse_8_digits( first ) );
+						first += 8;
+					}
+				}
 				if constexpr( skip_end_check ) {
 					for( auto dig = parse_digit( *first ); dig < 10U;
 					     ++first, dig = parse_digit( *first ) ) {
@@ -178,6 +196,9 @@ namespace daw::json {
 					fract_exponent_available = 0;
 					fract_first = nullptr;
 					exponent = whole_exponent_available;
+					if constexpr( ParseState::precise_ieee754( ) ) {
+						use_strtod = true;
+					}
 				} else {
 					whole_exponent_available =
 					  max_exponent::value - whole_exponent_available;
@@ -252,15 +273,37 @@ namespace daw::json {
 				}
 				if constexpr( std::is_floating_point_v<Result> and
 				              ParseState::precise_ieee754( ) ) {
-					// On std floating point types, check for conditions that cannot be
-					// precisely calculated using the normal method and use the fallback
-					// method(usually strtod/from_chars)
-					use_strtod |= exponent > 22;
-					use_strtod |= exponent < -22;
-					use_strtod |= significant_digits > 9007199254740992ULL;
-					if( DAW_UNLIKELY( use_strtod ) ) {
-						return json_details::parse_with_strtod<Result>( parse_state.first,
-						                                                parse_state.last );
+					if constexpr( eisel_lemire::is_supported_v<Result> ) {
+						// Here use_strtod means that significant_digits is only the
+						// leading digits of the number.  When the digit loops do not
+						// check the end, all the digits were read and may have overflowed
+						constexpr bool reads_all_digits =
+						  ParseState::is_zero_terminated_string( ) or
+						  ParseState::is_unchecked_input;
+						if( DAW_UNLIKELY( use_strtod or
+						                  not eisel_lemire::is_exact_power10<Result>(
+						                    significant_digits, exponent ) ) ) {
+							Result result{ };
+							if( DAW_LIKELY( not( reads_all_digits and use_strtod ) and
+							                eisel_lemire_to_real<Result>(
+							                  significant_digits, exponent, sign < 0,
+							                  use_strtod, result ) ) ) {
+								return result;
+							}
+							return json_details::parse_with_strtod<Result>(
+							  parse_state.first, parse_state.last );
+						}
+					} else {
+						// On std floating point types, check for conditions that cannot be
+						// precisely calculated using the normal method and use the
+						// fallback method(usually strtod/from_chars)
+						use_strtod |= exponent > 22;
+						use_strtod |= exponent < -22;
+						use_strtod |= significant_digits > 9007199254740992ULL;
+						if( DAW_UNLIKELY( use_strtod ) ) {
+							return json_details::parse_with_strtod<Result>(
+							  parse_state.first, parse_state.last );
+						}
 					}
 				}
 				return sign * power10<Result>(
@@ -318,10 +361,6 @@ namespace daw::json {
 				  DAW_UNLIKELY( sig_digit_count > max_storage_digits::value );
 				signed_t exponent_p1 = [&] {
 					if( DAW_UNLIKELY( last_char >= whole_last ) ) {
-						if constexpr( std::is_floating_point_v<Result> and
-						              ParseState::precise_ieee754( ) ) {
-							use_strtod = true;
-						}
 						// We have sig digits we cannot parse because there isn't enough
 						// room in a std::uint64_t
 						CharT *ptr =
@@ -329,6 +368,10 @@ namespace daw::json {
 						                ParseState::is_unchecked_input )>(
 						    last_char, parse_state.last );
 						auto const diff = ptr - last_char;
+						if constexpr( std::is_floating_point_v<Result> and
+						              ParseState::precise_ieee754( ) ) {
+							use_strtod |= diff > 0;
+						}
 
 						last_char = ptr;
 						if( significant_digits == 0 ) {
@@ -455,13 +498,33 @@ namespace daw::json {
 
 				if constexpr( std::is_floating_point_v<Result> and
 				              ParseState::precise_ieee754( ) ) {
-					use_strtod |= DAW_UNLIKELY( exponent > 22 );
-					use_strtod |= DAW_UNLIKELY( exponent < -22 );
-					use_strtod |=
-					  DAW_UNLIKELY( significant_digits > 9007199254740992ULL );
-					if( DAW_UNLIKELY( use_strtod ) ) {
-						using json_details::parse_with_strtod;
-						return parse_with_strtod<Result>( orig_first, orig_last );
+					if constexpr( eisel_lemire::is_supported_v<Result> ) {
+						// Here use_strtod means that significant_digits is only the
+						// leading digits of the number.  More digits than fit means they
+						// were all read, when the digit loops do not check the end, and
+						// may have overflowed
+						if( DAW_UNLIKELY( use_strtod or
+						                  not eisel_lemire::is_exact_power10<Result>(
+						                    significant_digits, exponent ) ) ) {
+							Result result{ };
+							if( DAW_LIKELY( sig_digit_count <= max_storage_digits::value and
+							                eisel_lemire_to_real<Result>(
+							                  significant_digits, exponent, sign < 0,
+							                  use_strtod, result ) ) ) {
+								return result;
+							}
+							using json_details::parse_with_strtod;
+							return parse_with_strtod<Result>( orig_first, orig_last );
+						}
+					} else {
+						use_strtod |= DAW_UNLIKELY( exponent > 22 );
+						use_strtod |= DAW_UNLIKELY( exponent < -22 );
+						use_strtod |=
+						  DAW_UNLIKELY( significant_digits > 9007199254740992ULL );
+						if( DAW_UNLIKELY( use_strtod ) ) {
+							using json_details::parse_with_strtod;
+							return parse_with_strtod<Result>( orig_first, orig_last );
+						}
 					}
 				}
 				return sign * power10<Result>(
@@ -16,6 +16,7 @@
 
 #include <daw/daw_likely.h>
 
+#include <cstddef>
 #include <string>
 #include <type_traits>
 
@@ -188,16 +189,40 @@ namespace daw::json {
 				inline constexpr char const escape_quotes[] = "\\\"";
 			}
 
+			/// @brief Construct a string of size zeros, using the allocator of the
+			/// parse state when the string type can use it.  This allows mixing
+			/// members with and without allocators when parsing with one
+			template<typename String, typename ParseState>
+			[[nodiscard]] static constexpr String
+			make_sized_string( ParseState &parse_state, std::size_t size ) {
+				if constexpr( std::is_constructible_v<
+				                String, std::size_t, char,
+				                typename ParseState::template allocator_type_as<char>> ) {
+					return String( size, '\0',
+					               parse_state.get_allocator_for( template_arg<char> ) );
+				} else {
+					(void)parse_state;
+					return String( size, '\0' );
+				}
+			}
+
+			/// @brief The string type escaped strings are unescaped into.  When the
+			/// result type cannot be sized and written to, e.g. interned_string, a
+			/// std::string is used and the result is constructed from it
+			template<typename JsonMember>
+			using unescaped_string_t = std::conditional_t<
+			  std::is_constructible_v<json_base_type<JsonMember>, std::size_t, char>,
+			  json_base_type<JsonMember>, std::string>;
+
 			// Fast path for parsing escaped strings to a std::string with the default
 			// appender
 			template<bool AllowHighEight, typename JsonMember, bool KnownBounds,
 			         typename ParseState>
 			[[nodiscard]] static constexpr auto // json_result<JsonMember>
 			parse_string_known_stdstring( ParseState &parse_state ) {
-				using string_type = json_base_type<JsonMember>;
-				string_type result =
-				  string_type( std::size( parse_state ), '\0',
-				               parse_state.get_allocator_for( template_arg<char> ) );
+				using string_type = unescaped_string_t<JsonMember>;
+				string_type result = make_sized_string<string_type>(
+				  parse_state, std::size( parse_state ) );
 				char *it = std::data( result );
 
 				bool const has_quote = parse_state.front( ) == '"';
@@ -308,7 +333,7 @@ namespace daw::json {
 					return result;
 				} else {
 					using constructor_t = typename JsonMember::constructor_t;
-					construct_value(
+					return construct_value(
 					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
 					  std::data( result ), daw::data_end( result ) );
 				}
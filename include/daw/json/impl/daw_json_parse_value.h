@@ -15,12 +15,14 @@
 #include "daw_json_parse_kv_array_iterator.h"
 #include "daw_json_parse_kv_class_iterator.h"
 #include "daw_json_parse_name.h"
+#include "daw_json_parse_policy_no_comments.h"
 #include "daw_json_parse_real.h"
 #include "daw_json_parse_std_string.h"
 #include "daw_json_parse_string_need_slow.h"
 #include "daw_json_parse_string_quote.h"
 #include "daw_json_parse_unsigned_int.h"
 #include "daw_json_parse_value_fwd.h"
+#include "daw_json_skip.h"
 #include "daw_json_traits.h"
 #include "daw_json_value_fwd.h"
 
@@ -29,6 +31,7 @@
 #include <daw/daw_traits.h>
 #include <daw/daw_utility.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
@@ -627,6 +630,60 @@ namespace daw::json {
 				}
 			}
 
+			template<typename Constructor>
+			using presize_container_test =
+			  decltype( Constructor::presize_container );
+
+			template<typename Constructor>
+			using container_size_hint_test = decltype( Constructor::size_hint );
+
+			template<typename Constructor>
+			[[nodiscard]] static constexpr bool constructor_presizes( ) {
+				if constexpr( daw::is_detected_v<presize_container_test,
+				                                 Constructor> ) {
+					return Constructor::presize_container;
+				} else {
+					return false;
+				}
+			}
+
+			template<typename Constructor>
+			[[nodiscard]] static constexpr std::size_t container_size_hint( ) {
+				if constexpr( daw::is_detected_v<container_size_hint_test,
+				                                 Constructor> ) {
+					return Constructor::size_hint;
+				} else {
+					return 0;
+				}
+			}
+
+			/// @brief Is the container of JsonMember sized before it is filled.  It
+			/// is when either options::PresizeArrays or the Constructor asks for it
+			/// and the Constructor accepts (first, last, count).  Documents with
+			/// comments are not counted
+			template<typename JsonMember, typename ParseState, typename Iterator>
+			inline constexpr bool should_presize_container_v =
+			  std::is_invocable_v<typename JsonMember::constructor_t, Iterator,
+			                      Iterator, std::size_t> and
+			  std::is_same_v<typename ParseState::CommentPolicy,
+			                 NoCommentSkippingPolicy> and
+			  ( ParseState::presize_arrays or
+			    constructor_presizes<typename JsonMember::constructor_t>( ) );
+
+			/// @brief The number of elements to size the container of JsonMember
+			/// for.  parse_state must be just past the opening bracket or brace
+			template<typename JsonMember, typename ParseState>
+			[[nodiscard]] static constexpr std::size_t
+			container_presize_count( ParseState const &parse_state ) {
+				constexpr std::size_t size_hint =
+				  container_size_hint<typename JsonMember::constructor_t>( );
+				if constexpr( size_hint > 0 ) {
+					return size_hint;
+				} else {
+					return count_elements( parse_state );
+				}
+			}
+
 			/**
 			 * Parse a key_value pair encoded as a json object where the keys are
 			 * the member names
@@ -654,9 +711,18 @@ namespace daw::json {
 				                               can_be_random_iterator_v<KnownBounds>>;
 
 				using constructor_t = typename JsonMember::constructor_t;
-				return construct_value(
-				  template_args<json_result<JsonMember>, constructor_t>, parse_state,
-				  iter_t( parse_state ), iter_t( ) );
+				if constexpr( should_presize_container_v<JsonMember, ParseState,
+				                                         iter_t> ) {
+					auto const count =
+					  container_presize_count<JsonMember>( parse_state );
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  iter_t( parse_state ), iter_t( ), count );
+				} else {
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  iter_t( parse_state ), iter_t( ) );
+				}
 			}
 
 			/**
@@ -685,9 +751,18 @@ namespace daw::json {
 				  json_parse_kv_array_iterator<JsonMember, ParseState,
 				                               can_be_random_iterator_v<KnownBounds>>;
 				using constructor_t = typename JsonMember::constructor_t;
-				return construct_value(
-				  template_args<json_result<JsonMember>, constructor_t>, parse_state,
-				  iter_t( parse_state ), iter_t( ) );
+				if constexpr( should_presize_container_v<JsonMember, ParseState,
+				                                         iter_t> ) {
+					auto const count =
+					  container_presize_count<JsonMember>( parse_state );
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  iter_t( parse_state ), iter_t( ), count );
+				} else {
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  iter_t( parse_state ), iter_t( ) );
+				}
 			}
 
 			template<typename JsonMember, bool KnownBounds = false,
@@ -706,9 +781,18 @@ namespace daw::json {
 				  json_parse_array_iterator<JsonMember, ParseState,
 				                            can_be_random_iterator_v<KnownBounds>>;
 				using constructor_t = typename JsonMember::constructor_t;
-				return construct_value(
-				  template_args<json_result<JsonMember>, constructor_t>, parse_state,
-				  iterator_t( parse_state ), iterator_t( ) );
+				if constexpr( should_presize_container_v<JsonMember, ParseState,
+				                                         iterator_t> ) {
+					auto const count =
+					  container_presize_count<JsonMember>( parse_state );
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  iterator_t( parse_state ), iterator_t( ), count );
+				} else {
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  iterator_t( parse_state ), iterator_t( ) );
+				}
 			}
 
 			template<typename JsonMember, bool KnownBounds = false,
@@ -726,6 +810,10 @@ namespace daw::json {
 				                 parse_state );
 				auto const sz = parse_value<size_member>(
 				  parse_state2, ParseTag<size_member::expected_type>{ } );
+				if constexpr( std::is_signed_v<daw::remove_cvref_t<decltype( sz )>> ) {
+					daw_json_ensure( sz >= 0, ErrorReason::NumberOutOfRange,
+					                 parse_state );
+				}
 
 				if constexpr( KnownBounds and ParseState::is_unchecked_input ) {
 					// We have the requested size and the actual size.  Let's see if they
@@ -744,10 +832,15 @@ namespace daw::json {
 				using iterator_t =
 				  json_parse_array_iterator<JsonMember, ParseState, false>;
 				using constructor_t = typename JsonMember::constructor_t;
+				// The size comes from the document, so it is only trusted as far as
+				// the remaining data can hold that many elements of at least a
+				// character and a separator each
+				auto const max_count = ( std::size( parse_state ) + 1U ) / 2U;
+				auto const count = ( std::min )(
+				  static_cast<std::size_t>( sz ), static_cast<std::size_t>( max_count ) );
 				return construct_value(
 				  template_args<json_result<JsonMember>, constructor_t>, parse_state,
-				  iterator_t( parse_state ), iterator_t( ),
-				  static_cast<std::size_t>( sz ) );
+				  iterator_t( parse_state ), iterator_t( ), count );
 			}
 
 			template<JsonBaseParseTypes BPT, typename JsonMembers, bool KnownBounds,
@@ -1191,7 +1284,44 @@ namespace daw::json {
 			DAW_ATTRIB_INLINE static constexpr json_result<JsonMember>
 			parse_value_unknown( ParseState &parse_state ) {
 				using constructor_t = typename JsonMember::constructor_t;
-				if constexpr( KnownBounds ) {
+				if constexpr( is_json_lazy_value_v<json_result<JsonMember>> ) {
+					// Lazy values keep the whole JSON text of the value, so string
+					// values keep their quotes
+					auto first = std::data( parse_state );
+					auto last = first;
+					if constexpr( KnownBounds ) {
+						// The bounds of a string exclude its quotes.  In valid JSON, a '"'
+						// can only directly follow a value when it is the closing quote.
+						// class_last is the end of the buffer here, see
+						// set_class_position, so it only keeps the read in bounds
+						last = first + std::size( parse_state );
+						if( first != nullptr and last < parse_state.class_last and
+						    *last == '"' ) {
+							--first;
+							++last;
+						}
+					} else {
+						daw_json_assert_weak( parse_state.has_more( ),
+						                      ErrorReason::UnexpectedEndOfData,
+						                      parse_state );
+						bool const is_string = parse_state.front( ) == '"';
+						auto value_parse_state = skip_value( parse_state );
+						if( std::data( value_parse_state ) == nullptr ) {
+							// A null value, it has an empty range
+							return construct_value(
+							  template_args<json_result<JsonMember>, constructor_t>,
+							  parse_state, std::data( value_parse_state ), std::size_t{ 0 } );
+						}
+						last = std::data( value_parse_state ) +
+						       std::size( value_parse_state );
+						if( is_string ) {
+							++last;
+						}
+					}
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  first, static_cast<std::size_t>( last - first ) );
+				} else if constexpr( KnownBounds ) {
 					return construct_value(
 					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
 					  std::data( parse_state ), std::size( parse_state ) );
@@ -151,6 +151,19 @@ namespace daw::json {
 				write_output( *m_writable, as_sv( chrs )... );
 			}
 
+			/// @brief Write a string whose data stays valid until the output is
+			/// finished with, such as the value of a string member.  Outputs that
+			/// support it may reference it instead of copying
+			DAW_ATTRIB_INLINE constexpr void write_reference( daw::string_view sv ) {
+				if constexpr( concepts::has_writable_output_reference_v<
+				                WritableType> ) {
+					concepts::writable_output_trait<WritableType>::write_reference(
+					  *m_writable, sv );
+				} else {
+					write_output( *m_writable, sv );
+				}
+			}
+
 			DAW_ATTRIB_INLINE constexpr void copy_buffer( char const *first,
 			                                              char const *last ) {
 				write(
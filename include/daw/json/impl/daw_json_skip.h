@@ -16,6 +16,7 @@
 #include "daw_json_parse_digit.h"
 #include "daw_json_parse_policy_policy_details.h"
 #include "daw_json_parse_string_quote.h"
+#include "daw_json_string_util.h"
 
 #include <daw/daw_attributes.h>
 #include <daw/daw_bit_cast.h>
@@ -26,6 +27,7 @@
 #include "daw_count_digits.h"
 #endif
 
+#include <cstddef>
 #include <iterator>
 
 namespace daw::json {
@@ -427,6 +429,81 @@ namespace daw::json {
 					daw_json_error( ErrorReason::InvalidStartOfValue, parse_state );
 				}
 			}
+
+			/***
+			 * Count the elements of the array, or the members of the class, that
+			 * parse_state is in.  parse_state must be just past the opening bracket
+			 * or brace.  Only the structural characters are visited, using the
+			 * vector kernels of the exec mode, and strings are skipped.  The result
+			 * is used to size containers and is not validated; a malformed value
+			 * gives a wrong count and is diagnosed when it is parsed.  A document
+			 * that ends inside an escape is an UnexpectedEndOfData error
+			 */
+			template<typename ParseState>
+			[[nodiscard]] static constexpr std::size_t
+			count_elements( ParseState const &parse_state ) {
+				using CharT = typename ParseState::CharT;
+				using exec_tag_t = typename ParseState::exec_tag_t;
+				CharT *first = parse_state.first;
+				CharT *const last = parse_state.last;
+
+				while( first < last and *first != '\0' and
+				       static_cast<unsigned char>( *first ) <= 0x20U ) {
+					++first;
+				}
+				if( first >= last or *first == ']' or *first == '}' ) {
+					return 0;
+				}
+				std::size_t commas = 0;
+				std::size_t depth = 0;
+				while( first < last ) {
+					first = mempbrk_checked<exec_tag_t, false, '"', ',', '[', ']', '{',
+					                        '}'>( first, last );
+					if( first >= last ) {
+						break;
+					}
+					switch( *first ) {
+					case '"':
+						++first;
+						if( first >= last ) {
+							return commas + 1;
+						}
+						if constexpr( traits::not_same<exec_tag_t,
+						                               constexpr_exec_tag>::value ) {
+							first = mem_skip_until_end_of_string<false>( ParseState::exec_tag,
+							                                             first, last );
+						} else {
+							while( first < last and *first != '"' ) {
+								if( *first == '\\' ) {
+									++first;
+									daw_json_ensure( first < last,
+									                 ErrorReason::UnexpectedEndOfData,
+									                 parse_state );
+								}
+								++first;
+							}
+						}
+						break;
+					case ',':
+						if( depth == 0 ) {
+							++commas;
+						}
+						break;
+					case '[':
+					case '{':
+						++depth;
+						break;
+					default:
+						if( depth == 0 ) {
+							return commas + 1;
+						}
+						--depth;
+						break;
+					}
+					++first;
+				}
+				return commas + 1;
+			}
 		} // namespace json_details
 	}   // namespace DAW_JSON_VER
 } // namespace daw::json
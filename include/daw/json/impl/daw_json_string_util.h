@@ -35,6 +35,9 @@ namespace daw::json {
 			template<char c, typename ExecTag, bool expect_long, typename CharT>
 			DAW_ATTRIB_FLATINLINE static inline constexpr CharT *
 			memchr_unchecked( CharT *first, CharT *last ) {
+				if constexpr( ExecTag::simd_width > 0 ) {
+					return mem_move_to_next_of<true, c>( ExecTag{ }, first, last );
+				}
 #if DAW_HAS_BUILTIN( __builtin_char_memchr )
 				if constexpr( expect_long ) {
 					return __builtin_char_memchr(
@@ -82,6 +85,9 @@ namespace daw::json {
 			template<char c, typename ExecTag, bool expect_long, typename CharT>
 			DAW_ATTRIB_FLATINLINE static inline constexpr CharT *
 			memchr_checked( CharT *first, CharT *last ) {
+				if constexpr( ExecTag::simd_width > 0 ) {
+					return mem_move_to_next_of<false, c>( ExecTag{ }, first, last );
+				}
 #if DAW_HAS_BUILTIN( __builtin_char_memchr )
 				if constexpr( expect_long ) {
 					return __builtin_char_memchr(
@@ -123,7 +129,11 @@ namespace daw::json {
 			template<typename ExecTag, bool expect_long, char... chars,
 			         typename CharT>
 			DAW_ATTRIB_FLATINLINE static inline constexpr CharT *
-			mempbrk_unchecked( CharT *first, CharT * /*last*/ ) {
+			mempbrk_unchecked( CharT *first, CharT *last ) {
+				if constexpr( ExecTag::simd_width > 0 ) {
+					return mem_move_to_next_of<true, chars...>( ExecTag{ }, first, last );
+				}
+				(void)last;
 #if DAW_HAS_BUILTIN( __builtin_strpbrk )
 				if constexpr( expect_long ) {
 					constexpr char const needles[]{ chars..., '\0' };
@@ -168,7 +178,9 @@ namespace daw::json {
 			         typename CharT>
 			DAW_ATTRIB_FLATINLINE static inline constexpr CharT *
 			mempbrk_checked( CharT *first, CharT *last ) {
-				if constexpr( expect_long ) {
+				if constexpr( ExecTag::simd_width > 0 ) {
+					return mem_move_to_next_of<false, chars...>( ExecTag{ }, first, last );
+				} else if constexpr( expect_long ) {
 #if defined( DAW_IS_CONSTANT_EVALUATED )
 					bool is_cxeval =
 					  DAW_IS_CONSTANT_EVALUATED( ) | DAW_CAN_CONSTANT_EVAL( first );
@@ -178,7 +190,8 @@ namespace daw::json {
 					if( ( not is_cxeval ) |
 					    daw::traits::not_same_v<ExecTag, constexpr_exec_tag> ) {
 
-						return mem_move_to_next_of<false, chars...>( first, last );
+						return mem_move_to_next_of<false, chars...>( runtime_exec_tag{ },
+						                                             first, last );
 					}
 					while( DAW_LIKELY( first < last ) and
 					       not parse_policy_details::in<chars...>( *first ) ) {
@@ -203,9 +216,31 @@ namespace daw::json {
 					return mempbrk_unchecked<ExecTag, expect_long, chars...>( first,
 					                                                          last );
 				} else {
-					return mempbrk_unchecked<ExecTag, expect_long, chars...>( first,
-					                                                          last );
+					return mempbrk_checked<ExecTag, expect_long, chars...>( first, last );
+				}
+			}
+
+			/// @brief Skip the JSON whitespace in [first, last).  The first couple
+			/// of characters are checked with scalar code as most JSON has very
+			/// little whitespace between tokens; only longer runs, like indentation,
+			/// use the vector kernel of ExecTag.  Requires ExecTag::simd_width > 0
+			template<typename ExecTag, typename CharT>
+			DAW_ATTRIB_INLINE static inline CharT *mem_skip_whitespace_run( CharT *first,
+			                                                               CharT *last ) {
+				static_assert( ExecTag::simd_width > 0,
+				               "Only SIMD exec modes have a whitespace kernel" );
+				constexpr auto is_ws = []( CharT c ) {
+					return ( static_cast<unsigned>( static_cast<unsigned char>( c ) ) -
+					         1U ) <= 0x1FU;
+				};
+				if( first >= last or not is_ws( *first ) ) {
+					return first;
+				}
+				++first;
+				if( first >= last or not is_ws( *first ) ) {
+					return first;
 				}
+				return mem_skip_whitespace( ExecTag{ }, first + 1, last );
 			}
 		} // namespace json_details
 	}   // namespace DAW_JSON_VER
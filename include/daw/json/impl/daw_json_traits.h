@@ -93,6 +93,13 @@ namespace daw::json {
 			inline constexpr bool is_json_map_alias_v =
 			  daw::is_detected_v<json_map_alias_test, T>;
 
+			template<typename T>
+			using json_lazy_value_test = typename T::i_am_a_json_lazy_value;
+
+			template<typename T>
+			inline constexpr bool is_json_lazy_value_v =
+			  daw::is_detected_v<json_lazy_value_test, T>;
+
 			template<typename T>
 			using force_aggregate_construction_test =
 			  typename json_data_contract<T>::force_aggregate_construction;
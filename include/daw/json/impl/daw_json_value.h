@@ -340,6 +340,45 @@ namespace daw::json {
 		  basic_json_value_iterator<PolicyFlags, Allocator> )
 		  -> basic_json_value_iterator_range<PolicyFlags, Allocator>;
 
+		namespace json_details {
+			/// @brief Walk json_path from jv.  Each step is a member name or an
+			/// [index], separated by '.', and a step that is not found gives an
+			/// empty value.  Value must provide find_class_member and find_element
+			template<json_options_t PolicyFlags, typename Value>
+			[[nodiscard]] constexpr Value find_json_path( Value jv,
+			                                              daw::string_view json_path ) {
+				while( not json_path.empty( ) and jv ) {
+					auto member = [&] {
+						if( json_path.front( ) == '[' ) {
+							return json_path.pop_front_until( ']' );
+						}
+						return json_path.pop_front_until( escaped_any_of<'.', '['>{ },
+						                                  nodiscard );
+					}( );
+					if( not json_path.empty( ) and json_path.front( ) == '.' ) {
+						json_path.remove_prefix( );
+					}
+					if( member.front( ) == '[' ) {
+						member.remove_prefix( );
+						auto index_ps =
+						  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags>>(
+						    std::data( member ), daw::data_end( member ) );
+						auto const index =
+						  unsigned_parser<std::size_t, options::JsonRangeCheck::Never,
+						                  true>( constexpr_exec_tag{ }, index_ps );
+
+						jv = jv.find_element( index );
+						if( not json_path.empty( ) and json_path.front( ) == '.' ) {
+							json_path.remove_prefix( );
+						}
+						continue;
+					}
+					jv = jv.find_class_member( member );
+				}
+				return jv;
+			}
+		} // namespace json_details
+
 		/// @brief A non-owning container for arbitrary JSON values that allows
 		/// movement/iteration through
 		/// @tparam ParseState see IteratorRange
@@ -437,37 +476,7 @@ namespace daw::json {
 			/// json_path
 			[[nodiscard]] constexpr basic_json_value
 			find_member( daw::string_view json_path ) const {
-				auto jv = *this;
-				while( not json_path.empty( ) and jv ) {
-					auto member = [&] {
-						if( json_path.front( ) == '[' ) {
-							return json_path.pop_front_until( ']' );
-						}
-						return json_path.pop_front_until( escaped_any_of<'.', '['>{ },
-						                                  nodiscard );
-					}( );
-					if( not json_path.empty( ) and json_path.front( ) == '.' ) {
-						json_path.remove_prefix( );
-					}
-					if( member.front( ) == '[' ) {
-						member.remove_prefix( );
-						auto index_ps =
-						  TryDefaultParsePolicy<BasicParsePolicy<PolicyFlags>>(
-						    std::data( member ), daw::data_end( member ) )
-						    .with_allocator( m_parse_state.get_allocator( ) );
-						auto const index = json_details::unsigned_parser<
-						  std::size_t, options::JsonRangeCheck::Never, true>(
-						  constexpr_exec_tag{ }, index_ps );
-
-						jv = jv.find_element( index );
-						if( not json_path.empty( ) and json_path.front( ) == '.' ) {
-							json_path.remove_prefix( );
-						}
-						continue;
-					}
-					jv = jv.find_class_member( member );
-				}
-				return jv;
+				return json_details::find_json_path<PolicyFlags>( *this, json_path );
 			}
 
 			/// @brief Parse the current json member as a Result.  The Result type
@@ -32,8 +32,12 @@
 #include <intrin.h>
 #endif
 #endif
+#if defined( DAW_ALLOW_AVX2 )
+#include <immintrin.h>
+#endif
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 
 namespace daw::json {
@@ -89,7 +93,7 @@ namespace daw::json {
 			}
 
 #if defined( DAW_ALLOW_SSE42 )
-			DAW_ATTRIB_INLINE __m128i
+			DAW_JSON_SSE42_FN __m128i
 			set_reverse( char c0, char c1 = 0, char c2 = 0, char c3 = 0, char c4 = 0,
 			             char c5 = 0, char c6 = 0, char c7 = 0, char c8 = 0,
 			             char c9 = 0, char c10 = 0, char c11 = 0, char c12 = 0,
@@ -98,32 +102,32 @@ namespace daw::json {
 				                     c4, c3, c2, c1, c0 );
 			}
 
-			DAW_ATTRIB_INLINE __m128i uload16_char_data( sse42_exec_tag,
+			DAW_JSON_SSE42_FN __m128i uload16_char_data( sse42_exec_tag,
 			                                             char const *ptr ) {
 				return _mm_loadu_si128( reinterpret_cast<__m128i const *>( ptr ) );
 			}
 
-			DAW_ATTRIB_INLINE __m128i load16_char_data( sse42_exec_tag,
+			DAW_JSON_SSE42_FN __m128i load16_char_data( sse42_exec_tag,
 			                                            char const *ptr ) {
 				return _mm_load_si128( reinterpret_cast<__m128i const *>( ptr ) );
 			}
 
 			template<char k>
-			DAW_ATTRIB_INLINE UInt32 mem_find_eq( sse42_exec_tag, __m128i block ) {
+			DAW_JSON_SSE42_FN UInt32 mem_find_eq( sse42_exec_tag, __m128i block ) {
 				__m128i const keys = _mm_set1_epi8( k );
 				__m128i const found = _mm_cmpeq_epi8( block, keys );
 				return to_uint32( _mm_movemask_epi8( found ) );
 			}
 
 			template<unsigned char k>
-			DAW_ATTRIB_INLINE UInt32 mem_find_gt( sse42_exec_tag, __m128i block ) {
+			DAW_JSON_SSE42_FN UInt32 mem_find_gt( sse42_exec_tag, __m128i block ) {
 				static __m128i const keys = _mm_set1_epi8( k );
 				__m128i const found = _mm_cmpgt_epi8( block, keys );
 				return to_uint32( _mm_movemask_epi8( found ) );
 			}
 
 			template<bool is_unchecked_input, char... keys, typename CharT>
-			DAW_ATTRIB_INLINE CharT *mem_move_to_next_of( sse42_exec_tag tag,
+			DAW_JSON_SSE42_FN CharT *mem_move_to_next_of( sse42_exec_tag tag,
 			                                              CharT *first,
 			                                              CharT *const last ) {
 
@@ -150,7 +154,7 @@ namespace daw::json {
 			}
 
 			template<bool is_unchecked_input, char... keys, typename CharT>
-			DAW_ATTRIB_INLINE CharT *
+			DAW_JSON_SSE42_FN CharT *
 			mem_move_to_next_not_of( sse42_exec_tag tag, CharT *first, CharT *last ) {
 				using keys_len = daw::constant<static_cast<int>( sizeof...( keys ) )>;
 				using compare_mode = daw::constant<static_cast<int>(
@@ -170,14 +174,56 @@ namespace daw::json {
 				}
 				__m128i b{ };
 				auto const max_pos = last - first;
+				memcpy( &b, first, static_cast<std::size_t>( max_pos ) );
 				int const result =
-				  _mm_cmpestri( a, keys_len::vlaue, b, 16, compare_mode::value );
+				  _mm_cmpestri( a, keys_len::value, b, 16, compare_mode::value );
 				if( result < max_pos ) {
 					return first + result;
 				}
 				return last;
 			}
 
+			/// Mask of the bytes that are whitespace.  This is the same test as
+			/// is_space_unchecked, a byte in [0x01, 0x20]
+			DAW_JSON_SSE42_FN std::uint32_t mem_find_space( sse42_exec_tag,
+			                                                __m128i block ) {
+				__m128i const shifted = _mm_sub_epi8( block, _mm_set1_epi8( 1 ) );
+				__m128i const clamped = _mm_min_epu8( shifted, _mm_set1_epi8( 0x1F ) );
+				__m128i const found = _mm_cmpeq_epi8( clamped, shifted );
+				return static_cast<std::uint32_t>( _mm_movemask_epi8( found ) );
+			}
+
+			/// Skip JSON whitespace(see is_space_unchecked) and return the first
+			/// non-whitespace character or last
+			template<typename CharT>
+			DAW_JSON_SSE42_FN CharT *mem_skip_whitespace( sse42_exec_tag tag,
+			                                              CharT *first,
+			                                              CharT *const last ) {
+				while( last - first >= 16 ) {
+					auto const val0 = uload16_char_data( tag, first );
+					std::uint32_t const other_positions =
+					  ~mem_find_space( tag, val0 ) & 0xFFFFU;
+					if( other_positions != 0 ) {
+						return first +
+						       find_lsb_set( tag, to_uint32( other_positions ) );
+					}
+					first += 16;
+				}
+				auto const max_pos = last - first;
+				if( max_pos <= 0 ) {
+					return last;
+				}
+				__m128i val1{ };
+				memcpy( &val1, first, static_cast<std::size_t>( max_pos ) );
+				std::uint32_t const other_positions =
+				  ~mem_find_space( tag, val1 ) &
+				  ( ( 1U << static_cast<unsigned>( max_pos ) ) - 1U );
+				if( other_positions != 0 ) {
+					return first + find_lsb_set( tag, to_uint32( other_positions ) );
+				}
+				return last;
+			}
+
 			template<typename U32>
 			DAW_ATTRIB_INLINE bool add_overflow( U32 value1, U32 value2,
 			                                     U32 &result ) {
@@ -229,7 +275,7 @@ namespace daw::json {
 				return ( even_bits::value ^ invert_mask ) & follow_escape;
 			}
 
-			DAW_ATTRIB_INLINE UInt32 prefix_xor( sse42_exec_tag, UInt32 bitmask ) {
+			DAW_JSON_SSE42_FN UInt32 prefix_xor( sse42_exec_tag, UInt32 bitmask ) {
 				__m128i const all_ones = _mm_set1_epi8( '\xFF' );
 				__m128i const result = _mm_clmulepi64_si128(
 				  _mm_set_epi32( 0, 0, 0, static_cast<std::int32_t>( bitmask ) ),
@@ -238,9 +284,9 @@ namespace daw::json {
 			}
 
 			template<bool is_unchecked_input, typename CharT>
-			inline CharT *mem_skip_until_end_of_string( simd_exec_tag tag,
-			                                            CharT *first,
-			                                            CharT *const last ) {
+			DAW_JSON_SSE42_FN CharT *
+			mem_skip_until_end_of_string( sse42_exec_tag tag, CharT *first,
+			                              CharT *const last ) {
 				UInt32 prev_escapes = 0_u32;
 				while( last - first >= 16 ) {
 					auto const val0 = uload16_char_data( tag, first );
@@ -285,8 +331,8 @@ namespace daw::json {
 			}
 
 			template<bool is_unchecked_input, typename CharT>
-			inline CharT *
-			mem_skip_until_end_of_string( simd_exec_tag tag, CharT *first,
+			DAW_JSON_SSE42_FN CharT *
+			mem_skip_until_end_of_string( sse42_exec_tag tag, CharT *first,
 			                              CharT *const last,
 			                              std::ptrdiff_t &first_escape ) {
 				CharT *const first_first = first;
@@ -295,7 +341,8 @@ namespace daw::json {
 					auto const val0 = uload16_char_data( tag, first );
 					UInt32 const backslashes = mem_find_eq<'\\'>( tag, val0 );
 					if( ( backslashes != 0 ) & ( first_escape < 0 ) ) {
-						first_escape = find_lsb_set( tag, backslashes );
+						first_escape =
+						  ( first - first_first ) + find_lsb_set( tag, backslashes );
 					}
 					UInt32 const escaped =
 					  find_escaped_branchless( tag, prev_escapes, backslashes );
@@ -316,7 +363,7 @@ namespace daw::json {
 							return first;
 						}
 						if( first_escape < 0 ) {
-							first_escape = first_first - first;
+							first_escape = first - first_first;
 						}
 						first += 2;
 					}
@@ -333,7 +380,7 @@ namespace daw::json {
 							return first;
 						}
 						if( first_escape < 0 ) {
-							first_escape = first_first - first;
+							first_escape = first - first_first;
 						}
 						first += 2;
 					}
@@ -342,6 +389,223 @@ namespace daw::json {
 				                                                            : last;
 			}
 
+#endif
+#if defined( DAW_ALLOW_AVX2 )
+			DAW_JSON_AVX2_FN __m256i uload32_char_data( avx2_exec_tag,
+			                                            char const *ptr ) {
+				return _mm256_loadu_si256( reinterpret_cast<__m256i const *>( ptr ) );
+			}
+
+			/// Load the remaining, less than 32, bytes of a range.  The unused bytes
+			/// are zero so that nothing past the end of the range is read
+			DAW_JSON_AVX2_FN __m256i uload32_char_data_partial(
+			  avx2_exec_tag, char const *ptr, std::ptrdiff_t sz ) {
+				alignas( 32 ) char buff[32]{ };
+				memcpy( buff, ptr, static_cast<std::size_t>( sz ) );
+				return _mm256_load_si256( reinterpret_cast<__m256i const *>( buff ) );
+			}
+
+			/// Mask with a bit set for each of the first sz bytes of a block
+			DAW_ATTRIB_INLINE constexpr std::uint32_t
+			avx2_prefix_mask( std::ptrdiff_t sz ) {
+				return sz >= 32 ? ~std::uint32_t{ 0 }
+				                : ( std::uint32_t{ 1 } << static_cast<unsigned>( sz ) ) -
+				                    1U;
+			}
+
+			template<char k>
+			DAW_JSON_AVX2_FN std::uint32_t mem_find_eq( avx2_exec_tag,
+			                                            __m256i block ) {
+				__m256i const keys = _mm256_set1_epi8( k );
+				__m256i const found = _mm256_cmpeq_epi8( block, keys );
+				return static_cast<std::uint32_t>( _mm256_movemask_epi8( found ) );
+			}
+
+			/// Mask of the bytes that are whitespace.  This is the same test as
+			/// is_space_unchecked, a byte in [0x01, 0x20]
+			DAW_JSON_AVX2_FN std::uint32_t mem_find_space( avx2_exec_tag,
+			                                               __m256i block ) {
+				__m256i const shifted =
+				  _mm256_sub_epi8( block, _mm256_set1_epi8( 1 ) );
+				__m256i const clamped =
+				  _mm256_min_epu8( shifted, _mm256_set1_epi8( 0x1F ) );
+				__m256i const found = _mm256_cmpeq_epi8( clamped, shifted );
+				return static_cast<std::uint32_t>( _mm256_movemask_epi8( found ) );
+			}
+
+			/// @pre value != 0
+			DAW_JSON_AVX2_FN std::ptrdiff_t find_lsb_set( avx2_exec_tag,
+			                                              std::uint32_t value ) {
+				return static_cast<std::ptrdiff_t>( _tzcnt_u32( value ) );
+			}
+
+			// 32bit version of the simdjson escape scanner.  The carry out of the
+			// addition is whether the next block starts escaped
+			DAW_ATTRIB_INLINE constexpr std::uint32_t
+			find_escaped_branchless( avx2_exec_tag, std::uint32_t &prev_escaped,
+			                         std::uint32_t backslashes ) {
+				backslashes &= ~prev_escaped;
+				std::uint32_t const follow_escape =
+				  ( backslashes << 1U ) | prev_escaped;
+				constexpr std::uint32_t even_bits = 0x5555'5555U;
+
+				std::uint32_t const odd_seq_start =
+				  backslashes & ~even_bits & ~follow_escape;
+				std::uint64_t const seq_start_on_even_bits =
+				  static_cast<std::uint64_t>( odd_seq_start ) + backslashes;
+				prev_escaped =
+				  static_cast<std::uint32_t>( seq_start_on_even_bits >> 32U );
+				std::uint32_t const invert_mask =
+				  static_cast<std::uint32_t>( seq_start_on_even_bits ) << 1U;
+
+				return ( even_bits ^ invert_mask ) & follow_escape;
+			}
+
+			template<bool is_unchecked_input, char... keys, typename CharT>
+			DAW_JSON_AVX2_FN CharT *mem_move_to_next_of( avx2_exec_tag tag,
+			                                             CharT *first,
+			                                             CharT *const last ) {
+				while( last - first >= 32 ) {
+					__m256i const block = uload32_char_data( tag, first );
+					std::uint32_t const key_positions =
+					  ( mem_find_eq<keys>( tag, block ) | ... );
+					if( key_positions != 0 ) {
+						return first + find_lsb_set( tag, key_positions );
+					}
+					first += 32;
+				}
+				auto const max_pos = last - first;
+				if( max_pos <= 0 ) {
+					return last;
+				}
+				__m256i const block = uload32_char_data_partial( tag, first, max_pos );
+				std::uint32_t const key_positions =
+				  ( mem_find_eq<keys>( tag, block ) | ... ) &
+				  avx2_prefix_mask( max_pos );
+				if( key_positions != 0 ) {
+					return first + find_lsb_set( tag, key_positions );
+				}
+				return last;
+			}
+
+			template<bool is_unchecked_input, char... keys, typename CharT>
+			DAW_JSON_AVX2_FN CharT *
+			mem_move_to_next_not_of( avx2_exec_tag tag, CharT *first,
+			                         CharT *const last ) {
+				while( last - first >= 32 ) {
+					__m256i const block = uload32_char_data( tag, first );
+					std::uint32_t const other_positions =
+					  ~( mem_find_eq<keys>( tag, block ) | ... );
+					if( other_positions != 0 ) {
+						return first + find_lsb_set( tag, other_positions );
+					}
+					first += 32;
+				}
+				auto const max_pos = last - first;
+				if( max_pos <= 0 ) {
+					return last;
+				}
+				__m256i const block = uload32_char_data_partial( tag, first, max_pos );
+				std::uint32_t const other_positions =
+				  ~( mem_find_eq<keys>( tag, block ) | ... ) &
+				  avx2_prefix_mask( max_pos );
+				if( other_positions != 0 ) {
+					return first + find_lsb_set( tag, other_positions );
+				}
+				return last;
+			}
+
+			/// Skip JSON whitespace(see is_space_unchecked) and return the first
+			/// non-whitespace character or last
+			template<typename CharT>
+			DAW_JSON_AVX2_FN CharT *mem_skip_whitespace( avx2_exec_tag tag,
+			                                             CharT *first,
+			                                             CharT *const last ) {
+				while( last - first >= 32 ) {
+					__m256i const block = uload32_char_data( tag, first );
+					std::uint32_t const other_positions =
+					  ~mem_find_space( tag, block );
+					if( other_positions != 0 ) {
+						return first + find_lsb_set( tag, other_positions );
+					}
+					first += 32;
+				}
+				auto const max_pos = last - first;
+				if( max_pos <= 0 ) {
+					return last;
+				}
+				__m256i const block = uload32_char_data_partial( tag, first, max_pos );
+				std::uint32_t const other_positions =
+				  ~mem_find_space( tag, block ) & avx2_prefix_mask( max_pos );
+				if( other_positions != 0 ) {
+					return first + find_lsb_set( tag, other_positions );
+				}
+				return last;
+			}
+
+			/// Find the closing quote of a string, skipping escaped quotes.  first is
+			/// after the opening quote.  When track_escape is true and a backslash
+			/// is found before the closing quote, first_escape is set to its offset
+			/// from first if it is not already set
+			template<bool is_unchecked_input, bool track_escape, typename CharT>
+			DAW_JSON_AVX2_FN CharT *
+			mem_skip_until_end_of_string_avx2( avx2_exec_tag tag, CharT *first,
+			                                   CharT *const last,
+			                                   std::ptrdiff_t &first_escape ) {
+				CharT *const first_first = first;
+				std::uint32_t prev_escaped = 0;
+				while( true ) {
+					auto const sz = last - first;
+					if( sz <= 0 ) {
+						return last;
+					}
+					__m256i const block = sz >= 32
+					                        ? uload32_char_data( tag, first )
+					                        : uload32_char_data_partial( tag, first, sz );
+					std::uint32_t const valid = avx2_prefix_mask( sz );
+					std::uint32_t const backslashes =
+					  mem_find_eq<'\\'>( tag, block ) & valid;
+					std::uint32_t const escaped =
+					  find_escaped_branchless( tag, prev_escaped, backslashes );
+					std::uint32_t const quotes =
+					  mem_find_eq<'"'>( tag, block ) & valid & ~escaped;
+					if constexpr( track_escape ) {
+						// Only the escapes before the closing quote are part of the string
+						std::uint32_t const in_string =
+						  quotes == 0 ? backslashes
+						              : backslashes & ( ( quotes & ( 0U - quotes ) ) - 1U );
+						if( ( in_string != 0 ) & ( first_escape < 0 ) ) {
+							first_escape =
+							  ( first - first_first ) + find_lsb_set( tag, in_string );
+						}
+					}
+					if( quotes != 0 ) {
+						return first + find_lsb_set( tag, quotes );
+					}
+					if( sz <= 32 ) {
+						return last;
+					}
+					first += 32;
+				}
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			DAW_JSON_AVX2_FN CharT *mem_skip_until_end_of_string( avx2_exec_tag tag,
+			                                                      CharT *first,
+			                                                      CharT *const last ) {
+				std::ptrdiff_t first_escape = 0;
+				return mem_skip_until_end_of_string_avx2<is_unchecked_input, false>(
+				  tag, first, last, first_escape );
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			DAW_JSON_AVX2_FN CharT *
+			mem_skip_until_end_of_string( avx2_exec_tag tag, CharT *first,
+			                              CharT *const last,
+			                              std::ptrdiff_t &first_escape ) {
+				return mem_skip_until_end_of_string_avx2<is_unchecked_input, true>(
+				  tag, first, last, first_escape );
+			}
 #endif
 			template<bool is_unchecked_input, char... keys, typename CharT>
 			DAW_ATTRIB_INLINE CharT *
@@ -422,7 +686,7 @@ namespace daw::json {
 						return first;
 					case '\\':
 						if( first_escape < 0 ) {
-							first_escape = first_first - first;
+							first_escape = first - first_first;
 						}
 						if constexpr( is_unchecked_input ) {
 							++first;
@@ -11,7 +11,9 @@
 #include "version.h"
 
 #include "../daw_json_data_contract.h"
+#include "daw_count_digits.h"
 #include "daw_json_assert.h"
+#include "daw_json_escape_scan.h"
 #include "daw_json_parse_iso8601_utils.h"
 #include "daw_json_serialize_options_impl.h"
 #include "daw_json_serialize_policy.h"
@@ -21,6 +23,7 @@
 #include <daw/daw_arith_traits.h>
 #include <daw/daw_cpp_feature_check.h>
 #include <daw/daw_cxmath.h>
+#include <daw/daw_is_constant_evaluated.h>
 #include <daw/daw_likely.h>
 #include <daw/daw_move.h>
 #include <daw/daw_traits.h>
@@ -33,6 +36,7 @@
 #include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <variant>
@@ -289,13 +293,105 @@ namespace daw::json {
 				}
 				daw_json_error( ErrorReason::InvalidUTFCodepoint );
 			}
+
+			/// @brief Write the code point cp as it must appear inside a JSON string
+			template<bool restrict_high, typename WritableType>
+			static constexpr WritableType escape_code_point( std::uint32_t cp,
+			                                                 WritableType it ) {
+				switch( cp ) {
+				case '"':
+					it.write( "\\\"" );
+					return it;
+				case '\\':
+					it.write( "\\\\" );
+					return it;
+				case '\b':
+					it.write( "\\b" );
+					return it;
+				case '\f':
+					it.write( "\\f" );
+					return it;
+				case '\n':
+					it.write( "\\n" );
+					return it;
+				case '\r':
+					it.write( "\\r" );
+					return it;
+				case '\t':
+					it.write( "\\t" );
+					return it;
+				default:
+					break;
+				}
+				if( cp < 0x20U ) {
+					return output_hex( static_cast<std::uint16_t>( cp ), it );
+				}
+				if constexpr( restrict_high ) {
+					if( cp >= 0x7FU and cp <= 0xFFFFU ) {
+						return output_hex( static_cast<std::uint16_t>( cp ), it );
+					}
+					if( cp > 0xFFFFU ) {
+						it = output_hex(
+						  static_cast<std::uint16_t>( 0xD7C0U + ( cp >> 10U ) ), it );
+						return output_hex(
+						  static_cast<std::uint16_t>( 0xDC00U + ( cp & 0x3FFU ) ), it );
+					}
+				}
+				utf32_to_utf8( cp, it );
+				return it;
+			}
+
+			template<typename Container, typename = void>
+			inline constexpr bool is_contiguous_char_container_v = false;
+
+			template<typename Container>
+			inline constexpr bool is_contiguous_char_container_v<
+			  Container,
+			  std::enable_if_t<std::is_same_v<
+			    char const *, DAW_TYPEOF( std::data( std::declval<Container const &>( ) ) )>>> =
+			  true;
+
+			/// @brief Write [first, last) as the contents of a JSON string.  The runs
+			/// that need no escaping are copied in bulk, found with the
+			/// mem_find_escape kernel of ExecTag, and only the code points at the
+			/// hits are decoded and escaped
+			template<bool restrict_high, bool ReferenceSource, typename ExecTag,
+			         typename WritableType>
+			[[nodiscard]] static WritableType
+			copy_escaped_runs( ExecTag tag, WritableType it, char const *first,
+			                   char const *const last ) {
+				while( first != last ) {
+					char const *const hit =
+					  mem_find_escape<restrict_high>( tag, first, last );
+					if( hit != first ) {
+						auto const run =
+						  daw::string_view( first, static_cast<std::size_t>( hit - first ) );
+						if constexpr( ReferenceSource ) {
+							it.write_reference( run );
+						} else {
+							it.write( run );
+						}
+					}
+					if( hit == last ) {
+						break;
+					}
+					auto chr_it = utf8::unchecked::iterator<char const *>( hit );
+					auto const cp = *chr_it++;
+					it = escape_code_point<restrict_high>( cp, it );
+					first = chr_it.base( );
+				}
+				return it;
+			}
 		} // namespace json_details
 
 		namespace utils {
+			/// @tparam ReferenceSource The data of container stays valid for the
+			/// whole serialization, so outputs may keep references to it instead of
+			/// copying.  See json_iovec_output
 			template<
 			  bool do_escape = false,
 			  options::EightBitModes EightBitMode = options::EightBitModes::AllowFull,
-			  typename WritableType, typename Container,
+			  bool ReferenceSource = false, typename WritableType, typename Container,
 			  std::enable_if_t<
 			    traits::is_container_like_v<daw::remove_cvref_t<Container>>,
 			    std::nullptr_t> = nullptr>
@@ -306,60 +402,57 @@ namespace daw::json {
 				  ( WritableType::restricted_string_output ==
 				    options::RestrictedStringOutput::OnlyAllow7bitsStrings );
 				if constexpr( do_escape ) {
+#if defined( DAW_IS_CONSTANT_EVALUATED )
+					if constexpr( json_details::is_contiguous_char_container_v<
+					                Container> ) {
+						if( not DAW_IS_CONSTANT_EVALUATED( ) ) {
+							char const *const first = std::data( container );
+							char const *const last = first + std::size( container );
+							if( json_details::use_avx2_escape_scan( ) ) {
+								return json_details::copy_escaped_runs<restrict_high,
+								                                       ReferenceSource>(
+								  avx2_exec_tag{ }, it, first, last );
+							}
+							return json_details::copy_escaped_runs<restrict_high,
+							                                       ReferenceSource>(
+							  runtime_exec_tag{ }, it, first, last );
+						}
+					}
+#endif
 					using iter = DAW_TYPEOF( std::begin( container ) );
 					using it_t = utf8::unchecked::iterator<iter>;
 					auto first = it_t( std::begin( container ) );
 					auto const last = it_t( std::end( container ) );
 					while( first != last ) {
-						auto const cp = *first++;
-						switch( cp ) {
-						case '"':
-							it.write( "\\\"" );
-							break;
-						case '\\':
-							it.write( "\\\\" );
-							break;
-						case '\b':
-							it.write( "\\b" );
-							break;
-						case '\f':
-							it.write( "\\f" );
-							break;
-						case '\n':
-							it.write( "\\n" );
-							break;
-						case '\r':
-							it.write( "\\r" );
-							break;
-						case '\t':
-							it.write( "\\t" );
-							break;
-						default:
-							if( cp < 0x20U ) {
-								it = json_details::output_hex( static_cast<std::uint16_t>( cp ),
-								                               it );
-								break;
-							}
+						it = json_details::escape_code_point<restrict_high>( *first++, it );
+					}
+				} else {
+#if defined( DAW_IS_CONSTANT_EVALUATED )
+					if constexpr( json_details::is_contiguous_char_container_v<
+					                Container> ) {
+						if( not DAW_IS_CONSTANT_EVALUATED( ) ) {
+							auto const value = daw::string_view( std::data( container ),
+							                                     std::size( container ) );
 							if constexpr( restrict_high ) {
-								if( cp >= 0x7FU and cp <= 0xFFFFU ) {
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( cp ), it );
-									break;
-								}
-								if( cp > 0xFFFFU ) {
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( 0xD7C0U + ( cp >> 10U ) ), it );
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( 0xDC00U + ( cp & 0x3FFU ) ),
-									  it );
-									break;
+								for( auto c : value ) {
+									daw_json_ensure(
+									  ( static_cast<unsigned char>( c ) >= 0x20U and
+									    static_cast<unsigned char>( c ) <= 0x7FU ),
+									  ErrorReason::InvalidStringHighASCII );
 								}
 							}
-							json_details::utf32_to_utf8( cp, it );
-							break;
+							if( value.empty( ) ) {
+								return it;
+							}
+							if constexpr( ReferenceSource ) {
+								it.write_reference( value );
+							} else {
+								it.write( value );
+							}
+							return it;
 						}
 					}
-				} else {
+#endif
 					for( auto c : container ) {
 						if constexpr( restrict_high ) {
 							daw_json_ensure( ( static_cast<unsigned char>( c ) >= 0x20U and
@@ -375,7 +468,7 @@ namespace daw::json {
 			template<
 			  bool do_escape = false,
 			  options::EightBitModes EightBitMode = options::EightBitModes::AllowFull,
-			  typename WriteableType>
+			  bool ReferenceSource = false, typename WriteableType>
 			[[nodiscard]] static constexpr WriteableType
 			copy_to_iterator( WriteableType it, char const *ptr ) {
 				if( ptr == nullptr ) {
@@ -386,56 +479,17 @@ namespace daw::json {
 				  ( WriteableType::restricted_string_output ==
 				    options::RestrictedStringOutput::OnlyAllow7bitsStrings );
 
+#if defined( DAW_IS_CONSTANT_EVALUATED )
+				if( not DAW_IS_CONSTANT_EVALUATED( ) ) {
+					return copy_to_iterator<do_escape, EightBitMode, ReferenceSource>(
+					  it, std::string_view( ptr ) );
+				}
+#endif
 				if constexpr( do_escape ) {
 					auto chr_it = utf8::unchecked::iterator<char const *>( ptr );
 					while( *chr_it.base( ) != '\0' ) {
-						auto const cp = *chr_it++;
-						switch( cp ) {
-						case '"':
-							it.write( "\\\"" );
-							break;
-						case '\\':
-							it.write( "\\\\" );
-							break;
-						case '\b':
-							it.write( "\\b" );
-							break;
-						case '\f':
-							it.write( "\\f" );
-							break;
-						case '\n':
-							it.write( "\\n" );
-							break;
-						case '\r':
-							it.write( "\\r" );
-							break;
-						case '\t':
-							it.write( "\\t" );
-							break;
-						default:
-							if( cp < 0x20U ) {
-								it = json_details::output_hex( static_cast<std::uint16_t>( cp ),
-								                               it );
-								break;
-							}
-							if constexpr( restrict_high ) {
-								if( cp >= 0x7FU and cp <= 0xFFFFU ) {
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( cp ), it );
-									break;
-								}
-								if( cp > 0xFFFFU ) {
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( 0xD7C0U + ( cp >> 10U ) ), it );
-									it = output_hex(
-									  static_cast<std::uint16_t>( 0xDC00U + ( cp & 0x3FFU ) ),
-									  it );
-									break;
-								}
-							}
-							json_details::utf32_to_utf8( cp, it );
-							break;
-						}
+						it = json_details::escape_code_point<restrict_high>( *chr_it++,
+						                                                     it );
 					}
 				} else {
 					while( *ptr != '\0' ) {
@@ -454,13 +508,14 @@ namespace daw::json {
 			template<
 			  bool do_escape = false,
 			  options::EightBitModes EightBitMode = options::EightBitModes::AllowFull,
-			  typename WriteableType, json_options_t P, typename A>
+			  bool ReferenceSource = false, typename WriteableType,
+			  json_options_t P, typename A>
 			[[nodiscard]] static constexpr WriteableType
 			copy_to_iterator( WriteableType it, basic_json_value<P, A> const &jv ) {
 				if( jv.is_null( ) ) {
 					return copy_to_iterator<do_escape, EightBitMode>( it, "null" );
 				} else {
-					return copy_to_iterator<do_escape, EightBitMode>(
+					return copy_to_iterator<do_escape, EightBitMode, ReferenceSource>(
 					  it, jv.get_string_view( ) );
 				}
 			}
@@ -635,31 +690,92 @@ namespace daw::json {
 			  typename std::conditional_t<std::is_enum_v<T>, base_int_type_impl<T>,
 			                              daw::traits::identity<T>>::type;
 
-			inline constexpr auto digits100 = [] {
+			/// @brief "00" through "99", used to write two digits at a time
+			inline constexpr auto digit_pairs = [] {
 				std::array<char[2], 100> result{ };
 				for( size_t n = 0; n < 100; ++n ) {
 					result[n][0] =
-					  static_cast<char>( ( n % 10 ) + static_cast<unsigned char>( '0' ) );
-					result[n][1] =
 					  static_cast<char>( ( n / 10 ) + static_cast<unsigned char>( '0' ) );
+					result[n][1] =
+					  static_cast<char>( ( n % 10 ) + static_cast<unsigned char>( '0' ) );
 				}
 				return result;
 			}( );
 
-			template<typename T>
-			static constexpr void reverse( T *first, T *last ) {
-				// Assume preconditions. This helps on CE in codegen but may
-				// not matter here with inlining
-				DAW_ASSUME( first and last );
-				DAW_ASSUME( first <= last );
-				auto rpos = last - first;
-				auto lpos = 0;
-				while( lpos < rpos ) {
-					--rpos;
-					auto tmp = DAW_MOVE( first[lpos] );
-					first[lpos] = DAW_MOVE( first[rpos] );
-					first[rpos] = DAW_MOVE( tmp );
-					++lpos;
+			/// @brief Write the digits of value so that the last one is just before
+			/// last
+			/// @return Pointer to the first digit written
+			DAW_ATTRIB_INLINE constexpr char *
+			write_digits_backward( char *last, std::uint32_t value ) {
+				while( value >= 100U ) {
+					auto const pair = value % 100U;
+					value /= 100U;
+					last -= 2;
+					last[0] = digit_pairs[pair][0];
+					last[1] = digit_pairs[pair][1];
+				}
+				if( value >= 10U ) {
+					last -= 2;
+					last[0] = digit_pairs[value][0];
+					last[1] = digit_pairs[value][1];
+					return last;
+				}
+				*--last = static_cast<char>( '0' + static_cast<char>( value ) );
+				return last;
+			}
+
+			/// @brief Write the digits of value so that the last one is just before
+			/// last.  The 32bit loop is used once the rest of value fits
+			/// @return Pointer to the first digit written
+			DAW_ATTRIB_INLINE constexpr char *
+			write_digits_backward( char *last, std::uint64_t value ) {
+				while( value > 0xFFFF'FFFFULL ) {
+					auto const pair = static_cast<std::size_t>( value % 100U );
+					value /= 100U;
+					last -= 2;
+					last[0] = digit_pairs[pair][0];
+					last[1] = digit_pairs[pair][1];
+				}
+				return write_digits_backward( last,
+				                              static_cast<std::uint32_t>( value ) );
+			}
+
+			/// @brief Write the decimal digits of a non-negative integer starting at
+			/// ptr.  The digits are counted first so that they are written in place
+			/// from the end, two at a time
+			/// @return Pointer to one past the last digit
+			template<typename Integer>
+			constexpr char *write_decimal( char *ptr, Integer value ) {
+				if constexpr( sizeof( Integer ) <= sizeof( std::uint32_t ) ) {
+					auto const v = static_cast<std::uint32_t>( value );
+					auto *const last = ptr + count_decimal_digits( v );
+					(void)write_digits_backward( last, v );
+					return last;
+				} else if constexpr( sizeof( Integer ) <= sizeof( std::uint64_t ) ) {
+					auto const v = static_cast<std::uint64_t>( value );
+					auto *const last = ptr + count_decimal_digits( v );
+					(void)write_digits_backward( last, v );
+					return last;
+				} else {
+					// Peel off 19 digits at a time with wide division until the rest
+					// fits in 64bits
+					constexpr auto ten19 =
+					  static_cast<Integer>( powers_of_ten_u64[19] );
+					auto *const result = ptr + count_decimal_digits( value );
+					auto *last = result;
+					while( value > static_cast<Integer>( ~std::uint64_t{ 0 } ) ) {
+						auto const low = static_cast<std::uint64_t>( value % ten19 );
+						value /= ten19;
+						auto *const first = last - 19;
+						auto *digit = write_digits_backward( last, low );
+						while( digit != first ) {
+							*--digit = '0';
+						}
+						last = first;
+					}
+					(void)write_digits_backward( last,
+					                             static_cast<std::uint64_t>( value ) );
+					return result;
 				}
 			}
 
@@ -677,50 +793,34 @@ namespace daw::json {
 
 				if constexpr( std::disjunction_v<std::is_enum<parse_to_t>,
 				                                 daw::is_integral<parse_to_t>> ) {
-					auto v = static_cast<under_type>( value );
+					auto const v = static_cast<under_type>( value );
 
 					char buff[daw::numeric_limits<under_type>::digits10 + 10]{ };
-					char *num_start = buff;
 					char *ptr = buff;
 					if constexpr( JsonMember::literal_as_string ==
 					              options::LiteralAsStringOpt::Always ) {
 						*ptr++ = '"';
-						++num_start;
 					}
-					if( v < 0 ) {
+					if( v >= 0 ) {
+						ptr = write_decimal( ptr, v );
+					} else {
 						*ptr++ = '-';
-						++num_start;
-						// Do 1 round here just in case we are
-						// daw::numeric_limits<intmax_t>::min( ) and cannot negate
-						// This is a subtraction because when v < 0, v % 100 is negative
-						auto const tmp = -static_cast<std::size_t>( v % 10 );
-						v /= -10;
-						*ptr++ = digits100[tmp][0];
-						if( v == 0 ) {
-							if constexpr( JsonMember::literal_as_string ==
-							              options::LiteralAsStringOpt::Always ) {
-								*ptr++ = '"';
+						if constexpr( sizeof( under_type ) <= sizeof( std::uint64_t ) ) {
+							// Negating in unsigned arithmetic is fine for
+							// daw::numeric_limits<under_type>::min( )
+							ptr = write_decimal(
+							  ptr, std::uint64_t{ 0 } - static_cast<std::uint64_t>( v ) );
+						} else {
+							// Write the last digit on its own as the minimum value of a
+							// wide type cannot be negated.  v % 10 is negative here
+							auto const last_digit = -static_cast<int>( v % 10 );
+							auto const rest = static_cast<under_type>( -( v / 10 ) );
+							if( rest != 0 ) {
+								ptr = write_decimal( ptr, rest );
 							}
-							it.copy_buffer( buff, ptr );
-							return it;
+							*ptr++ = static_cast<char>( '0' + last_digit );
 						}
 					}
-
-					if( v == 0 ) {
-						*ptr++ = '0';
-					}
-					while( v >= 10 ) {
-						auto const tmp = static_cast<std::size_t>( v % 100 );
-						v /= 100;
-						ptr[0] = digits100[tmp][0];
-						ptr[1] = digits100[tmp][1];
-						ptr += 2;
-					}
-					if( v > 0 ) {
-						*ptr++ = static_cast<char>( '0' + static_cast<char>( v ) );
-					}
-
-					reverse( num_start, ptr );
 					if constexpr( JsonMember::literal_as_string ==
 					              options::LiteralAsStringOpt::Always ) {
 						*ptr++ = '"';
@@ -766,26 +866,15 @@ namespace daw::json {
 				} else if constexpr( std::disjunction_v<
 				                       std::is_enum<parse_to_t>,
 				                       daw::is_integral<parse_to_t>> ) {
-					auto v = static_cast<under_type>( value );
+					auto const v = static_cast<under_type>( value );
 
 					if( DAW_UNLIKELY( v == 0 ) ) {
 						it.put( '0' );
 					} else {
 						daw_json_ensure( v > 0, ErrorReason::NumberOutOfRange );
 						char buff[daw::numeric_limits<under_type>::digits10 + 10]{ };
-						char *ptr = buff;
-						while( v >= 10 ) {
-							auto const tmp = static_cast<std::size_t>( v % 100U );
-							v /= 100U;
-							ptr[0] = digits100[tmp][0];
-							ptr[1] = digits100[tmp][1];
-							ptr += 2;
-						}
-						if( v > 0 ) {
-							*ptr++ = static_cast<char>( '0' + static_cast<char>( v ) );
-						}
-						reverse( buff, ptr );
-						it.copy_buffer( buff, ptr );
+						char *const last = write_decimal( buff, v );
+						it.copy_buffer( buff, last );
 					}
 				} else {
 					// Fallback to ADL
@@ -841,7 +930,8 @@ namespace daw::json {
 				  JsonMember::eight_bit_mode;
 				it.put( '"' );
 				if( std::size( value ) > 0U ) {
-					it = utils::copy_to_iterator<false, eight_bit_mode>( it, value );
+					it =
+					  utils::copy_to_iterator<false, eight_bit_mode, true>( it, value );
 				}
 				it.put( '"' );
 				return it;
@@ -855,7 +945,7 @@ namespace daw::json {
 				constexpr options::EightBitModes eight_bit_mode =
 				  JsonMember::eight_bit_mode;
 				it.put( '"' );
-				it = utils::copy_to_iterator<true, eight_bit_mode>( it, value );
+				it = utils::copy_to_iterator<true, eight_bit_mode, true>( it, value );
 				it.put( '"' );
 				return it;
 			}
@@ -928,7 +1018,21 @@ namespace daw::json {
 			[[nodiscard]] static inline constexpr WriteableType
 			to_json_string_unknown( WriteableType it, parse_to_t const &value ) {
 
-				return utils::copy_to_iterator( it, value );
+				if constexpr( is_json_lazy_value_v<parse_to_t> ) {
+					// Values that were never accessed are written back verbatim
+					if( not value.has_value( ) ) {
+						if( value.get_raw( ).empty( ) ) {
+							return utils::copy_to_iterator( it, "null" );
+						}
+						return utils::copy_to_iterator( it, value.get_raw( ) );
+					}
+					using value_member =
+					  json_deduced_type<typename parse_to_t::value_type>;
+					return to_daw_json_string<value_member>(
+					  ParseTag<value_member::expected_type>{ }, it, value.get( ) );
+				} else {
+					return utils::copy_to_iterator( it, value );
+				}
 			}
 
 			template<typename JsonMember, typename WriteableType, typename parse_to_t>
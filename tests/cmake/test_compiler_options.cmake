@@ -4,9 +4,14 @@ option( DAW_WERROR "Enable WError for test builds" OFF )
 option( DAW_ALLOW_SSE42 "EXPERIMENTAL: Enable WError for test builds" OFF )
 option( DAW_JSON_COVERAGE "Enable code coverage(gcc/clang)" OFF )
 
+option( DAW_ALLOW_AVX2 "EXPERIMENTAL: Enable AVX2 exec mode kernels" OFF )
+
 if( DAW_ALLOW_SSE42 )
     add_compile_definitions( DAW_ALLOW_SSE42 )
 endif()
+if( DAW_ALLOW_AVX2 )
+    add_compile_definitions( DAW_ALLOW_AVX2 )
+endif()
 if( ${CMAKE_CXX_COMPILER_ID} STREQUAL "Clang" OR ${CMAKE_CXX_COMPILER_ID} STREQUAL "AppleClang" )
     if( MSVC )
         message( STATUS "Clang-CL ${CMAKE_CXX_COMPILER_VERSION} detected" )
@@ -0,0 +1,120 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_arena.h>
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Child {
+	daw::json::json_arena_string name;
+	daw::json::json_arena_vector<int> values;
+};
+
+struct Parent {
+	daw::json::json_arena_string title;
+	std::string plain;
+	daw::json::json_arena_vector<Child> children;
+	std::vector<int> plain_values;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Child> {
+		static constexpr char const name[] = "name";
+		static constexpr char const values[] = "values";
+		using type =
+		  json_member_list<json_string<name, json_arena_string>,
+		                   json_array<values, int, json_arena_vector<int>>>;
+	};
+
+	template<>
+	struct json_data_contract<Parent> {
+		static constexpr char const title[] = "title";
+		static constexpr char const plain[] = "plain";
+		static constexpr char const children[] = "children";
+		static constexpr char const plain_values[] = "plain_values";
+		using type = json_member_list<
+		  json_string<title, json_arena_string>, json_string<plain>,
+		  json_array<children, Child, json_arena_vector<Child>>,
+		  json_array<plain_values, int>>;
+	};
+} // namespace daw::json
+
+bool from_arena( daw::json::json_arena_string const &s,
+                 daw::json::json_arena const &arena ) {
+	return &s.get_allocator( ).arena( ) == &arena;
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr std::string_view json_doc = R"json(
+{
+	"title": "A title that is longer than the small string buffer\t(escaped)",
+	"plain": "Not from the arena, but \"escaped\"",
+	"children": [
+		{ "name": "first child with a long enough name", "values": [1, 2, 3] },
+		{ "name": "second child with an \"escaped\" name", "values": [4, 5] }
+	],
+	"plain_values": [6, 7, 8]
+}
+)json";
+
+	auto arena = json_arena( 256 );
+	for( int n = 0; n < 3; ++n ) {
+		auto const p = from_json_arena<Parent>( json_doc, arena );
+		ensure( p.title ==
+		        "A title that is longer than the small string buffer\t(escaped)" );
+		ensure( from_arena( p.title, arena ) );
+		ensure( p.plain == R"(Not from the arena, but "escaped")" );
+		ensure( p.children.size( ) == 2 );
+		ensure( &p.children.get_allocator( ).arena( ) == &arena );
+		ensure( p.children[0].name == "first child with a long enough name" );
+		ensure( from_arena( p.children[0].name, arena ) );
+		ensure( p.children[1].name == R"(second child with an "escaped" name)" );
+		ensure( from_arena( p.children[1].name, arena ) );
+		ensure( p.children[1].values.size( ) == 2 and
+		        p.children[1].values[1] == 5 );
+		ensure( &p.children[1].values.get_allocator( ).arena( ) == &arena );
+		ensure( p.plain_values == std::vector<int>{ 6, 7, 8 } );
+		ensure( arena.used( ) > 0 );
+		arena.reset( );
+		ensure( arena.used( ) == 0 );
+	}
+	// After the first parse, the retained chunk is enough for the rest
+	auto const capacity = arena.capacity( );
+	{
+		auto const p = from_json_arena<Parent>(
+		  json_doc, arena, options::parse_flags<options::CheckedParseMode::no> );
+		ensure( p.children.size( ) == 2 );
+	}
+	ensure( arena.capacity( ) == capacity );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,121 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_buffered_output.h>
+#include <daw/json/daw_json_iostream.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct LogEntry {
+	std::string level;
+	std::string message;
+	int code;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<LogEntry> {
+		using opt_into_iostreams = void;
+
+		static constexpr char const level[] = "level";
+		static constexpr char const message[] = "message";
+		static constexpr char const code[] = "code";
+		using type = json_member_list<json_string<level>, json_string<message>,
+		                              json_number<code, int>>;
+
+		static auto to_json_data( LogEntry const &v ) {
+			return std::forward_as_tuple( v.level, v.message, v.code );
+		}
+	};
+} // namespace daw::json
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	auto entries = std::vector<LogEntry>( );
+	for( int n = 0; n < 100; ++n ) {
+		entries.push_back( LogEntry{ "info", std::string( n, 'm' ) + "\"", n } );
+	}
+	auto const expected = to_json_array( entries );
+
+	{
+		// A buffer smaller than many of the pieces written
+		auto ss = std::ostringstream( );
+		{
+			auto out = buffered_output<std::ostream, 16>( ss );
+			(void)to_json_array( entries, out );
+			ensure( out.size( ) < 16 );
+		}
+		ensure( ss.str( ) == expected );
+	}
+	{
+		auto ss = std::ostringstream( );
+		auto out = buffered_output( ss );
+		for( auto const &e : entries ) {
+			(void)to_json( e, out );
+			out.put( '\n' );
+		}
+		ensure( out.size( ) > 0 );
+		out.flush( );
+		ensure( out.size( ) == 0 );
+		ensure( ss.str( ).size( ) > 4096 );
+		ensure( ss.str( ).substr( 0, ss.str( ).find( '\n' ) ) ==
+		        to_json( entries[0] ) );
+	}
+	{
+		std::FILE *f = std::tmpfile( );
+		ensure( f != nullptr );
+		{
+			auto out = buffered_output<std::FILE *, 64>( f );
+			(void)to_json_array( entries, out,
+			                     options::output_flags<
+			                       options::SerializationFormat::Pretty> );
+		}
+		auto const size = std::ftell( f );
+		ensure( size > 0 );
+		std::rewind( f );
+		auto result = std::string( static_cast<std::size_t>( size ), '\0' );
+		ensure( std::fread( result.data( ), 1, result.size( ), f ) ==
+		        result.size( ) );
+		std::fclose( f );
+		ensure( result ==
+		        to_json_array( entries,
+		                       options::output_flags<
+		                         options::SerializationFormat::Pretty> ) );
+	}
+	{
+		auto ss = std::ostringstream( );
+		ss << entries[3] << ' ' << entries;
+		ensure( ss.str( ) == to_json( entries[3] ) + " " + expected );
+	}
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -22,6 +22,7 @@
 #include <cfloat>
 #include <chrono>
 #include <climits>
+#include <cmath>
 #include <cstdint>
 #include <deque>
 #include <iostream>
@@ -623,6 +624,32 @@ void test_lots_of_doubles( ) {
 	}
 }
 
+/// Round trip random doubles through their shortest few representations.
+/// These fit in the significand without truncation and must parse exactly
+template<bool KnownBounds = false, int NUM_VALS = 1'000'000>
+void test_lots_of_short_doubles( ) {
+	auto rd = std::random_device( );
+	auto rng = std::mt19937_64( rd( ) );
+	std::size_t mismatches = 0;
+	for( int i = 0; i < NUM_VALS; ++i ) {
+		auto const d = daw::bit_cast<double>( rng( ) );
+		if( not std::isfinite( d ) ) {
+			continue;
+		}
+		char buffer[128];
+		std::snprintf( buffer, 128, "%.*g", 15 + ( i % 3 ), d );
+		if( test_dblparse<KnownBounds, true>( buffer ) != 0 ) {
+			++mismatches;
+		}
+	}
+	std::cout << std::dec << "short doubles not parsed exactly: " << mismatches
+	          << '\n';
+	if( mismatches != 0 ) {
+		std::cerr << "ERROR: Precise parsing was not exact\n";
+		exit( 1 );
+	}
+}
+
 template<int NUM_VALS = 100, int exp_min = -5, int exp_max = 6>
 void test_show_lots_of_doubles( ) {
 	auto rd = std::random_device( );
@@ -1043,6 +1070,14 @@ int main( int, char ** ) {
 		test_dblparse( "8725540998407961.3743556965848965343e-308", true );
 		test_dblparse( "1e-10000", true );
 		test_dblparse<false, true>( "0.9868011474609375", true );
+		test_dblparse<false, true>( "9007199254740993", true );
+		test_dblparse<true, true>( "9007199254740993", true );
+		test_dblparse<false, true>( "2.2250738585072011e-308", true );
+		test_dblparse<true, true>( "4.9406564584124654e-324", true );
+		test_dblparse<false, true>( "2.4703282292062328e-324", true );
+		test_dblparse<false, true>( "1.7976931348623157e308", true );
+		test_dblparse<true, true>( "1.7976931348623159e308", true );
+		test_dblparse<false, true>( "-123456789012345678e-330", true );
 		std::cout.precision( std::numeric_limits<double>::max_digits10 );
 #if defined( LDBL_MAX )
 		std::cout << "result: " << from_json<long double>( "1e-10000" ) << '\n';
@@ -1090,6 +1125,9 @@ int main( int, char ** ) {
 		test_lots_of_doubles<false, true>( );
 		std::cout << "Known Bounds\n";
 		test_lots_of_doubles<true, true>( );
+		std::cout << "Precise FP Parse of short doubles\n";
+		test_lots_of_short_doubles<false>( );
+		test_lots_of_short_doubles<true>( );
 
 #if defined( LDBL_MAX )
 		if constexpr( sizeof( double ) < sizeof( long double ) ) {
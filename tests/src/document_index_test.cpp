@@ -0,0 +1,128 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_document_index.h>
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr std::string_view json_doc = R"(
+	{
+		"name": "config \"main\"",
+		"servers": [
+			{ "host": "a.example", "port": 80, "tags": [] },
+			{ "host": "b.example", "port": 8080, "tags": [ "x", "y" ] }
+		],
+		"limits": { "rate": 1.5e3, "burst": null, "strict": true },
+		"empty": {}
+	})";
+
+	auto const index = json_document_index( json_doc );
+	auto const root = index.root( );
+	ensure( root.type( ) == JsonBaseParseTypes::Class );
+	ensure( root.size( ) == 4 );
+	ensure( index.size( ) == 18 );
+	ensure( not root.parent( ) and not root.name( ) );
+
+	// Every lookup agrees with basic_json_value
+	auto const jv = basic_json_value( json_doc );
+	for( std::string_view path :
+	     { "name", "servers", "servers[1].port", "servers[1].tags[1]",
+	       "limits.rate", "limits.burst", "limits.strict", "empty" } ) {
+		auto const v = index[path];
+		ensure( static_cast<bool>( v ) );
+		ensure( v.type( ) == jv[path].type( ) );
+		ensure( v.get_raw_json( ).data( ) == jv[path].get_raw_state( ).first );
+	}
+	ensure( index["servers[1].port"].as<int>( ) == 8080 );
+	ensure( index["limits.rate"].as<double>( ) == 1500.0 );
+	ensure( index["name"].as<std::string>( ) == "config \"main\"" );
+	ensure( index["name"].get_raw_json( ) == R"("config \"main\"")" );
+	ensure( index["servers"].get_raw_json( ).front( ) == '[' and
+	        index["servers"].get_raw_json( ).back( ) == ']' );
+
+	// Navigation
+	auto const servers = root.find_class_member( "servers" );
+	ensure( servers.size( ) == 2 );
+	auto const second = servers[1];
+	ensure( second.parent( ).get_raw_json( ) == servers.get_raw_json( ) );
+	ensure( servers[0].next_sibling( ).get_raw_json( ) ==
+	        second.get_raw_json( ) );
+	ensure( not second.next_sibling( ) );
+	ensure( *second.find_class_member( "host" ).name( ) == "host" );
+	ensure( second.find_class_member( "host" ).next_sibling( ).as<int>( ) ==
+	        8080 );
+	ensure( second["tags"].size( ) == 2 );
+	ensure( servers[0]["tags"].size( ) == 0 );
+	ensure( not servers[2] );
+	ensure( not root["missing"] );
+	ensure( not root["limits.rate.x"] );
+	ensure( index["empty"].size( ) == 0 );
+
+	auto hosts = std::vector<std::string>( );
+	for( auto s = servers[0]; s; s = s.next_sibling( ) ) {
+		hosts.push_back( s["host"].as<std::string>( ) );
+	}
+	ensure( hosts == std::vector<std::string>{ "a.example", "b.example" } );
+
+	auto const arr = json_document_index( "[1,[2,[3]],4]" );
+	ensure( arr.root( )[1][1][0].as<int>( ) == 3 );
+	ensure( arr.root( )[2].as<int>( ) == 4 );
+	ensure( arr.size( ) == 7 );
+
+	// Scalars as the whole document, ending exactly at the end of data
+	constexpr std::string_view scalars[][2] = { { "null", "null" },
+	                                            { " null ", "null" },
+	                                            { "true", "true" },
+	                                            { "42", "42" } };
+	for( auto const &[doc, raw] : scalars ) {
+		auto const scalar = json_document_index( doc );
+		ensure( scalar.size( ) == 1 );
+		ensure( scalar.root( ).get_raw_json( ) == raw );
+	}
+	ensure( json_document_index( "null" ).root( ).type( ) ==
+	        JsonBaseParseTypes::Null );
+	ensure( json_document_index( "[null]" ).root( )[0].get_raw_json( ) ==
+	        "null" );
+
+#ifdef DAW_USE_EXCEPTIONS
+	for( std::string_view bad :
+	     { "[1 2]", R"({"a" 1})", "[1,]", R"({"a":1)", "nul", "[nulx]" } ) {
+		bool has_error = false;
+		try {
+			(void)json_document_index( bad );
+		} catch( json_exception const & ) { has_error = true; }
+		ensure( has_error );
+	}
+#endif
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,156 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/impl/daw_json_cpu_features.h>
+#include <daw/json/impl/daw_json_escape_scan.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+// Escape the way the serializer is expected to for strings without high bytes
+std::string escape_ascii( std::string const &value ) {
+	std::string result = "\"";
+	for( char c : value ) {
+		switch( c ) {
+		case '"':
+			result += "\\\"";
+			break;
+		case '\\':
+			result += "\\\\";
+			break;
+		case '\b':
+			result += "\\b";
+			break;
+		case '\f':
+			result += "\\f";
+			break;
+		case '\n':
+			result += "\\n";
+			break;
+		case '\r':
+			result += "\\r";
+			break;
+		case '\t':
+			result += "\\t";
+			break;
+		default:
+			if( static_cast<unsigned char>( c ) < 0x20U ) {
+				char buff[7];
+				std::snprintf( buff, sizeof( buff ), "\\u%04X",
+				               static_cast<unsigned>( c ) );
+				result += buff;
+			} else {
+				result += c;
+			}
+		}
+	}
+	result += '"';
+	return result;
+}
+
+// Compare the escape scan of ExecTag against a byte at a time search, for a
+// hit at every offset of blocks and tails
+template<typename ExecTag>
+void check_kernel( ) {
+	using daw::json::json_details::mem_find_escape;
+	using daw::json::json_details::needs_escape;
+	constexpr char const hits[] = { '"', '\\', '\x01', '\x7F', '\xC3' };
+	for( std::size_t len = 0; len < 80; ++len ) {
+		for( std::size_t pos = 0; pos <= len; ++pos ) {
+			for( char hit : hits ) {
+				auto value = std::string( len, 'a' );
+				if( pos < len ) {
+					value[pos] = hit;
+				}
+				char const *const first = value.data( );
+				char const *const last = first + value.size( );
+				auto expected = first;
+				while( expected != last and not needs_escape<true>( *expected ) ) {
+					++expected;
+				}
+				ensure( mem_find_escape<true>( ExecTag{ }, first, last ) == expected );
+				expected = first;
+				while( expected != last and not needs_escape<false>( *expected ) ) {
+					++expected;
+				}
+				ensure( mem_find_escape<false>( ExecTag{ }, first, last ) == expected );
+			}
+		}
+	}
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	check_kernel<runtime_exec_tag>( );
+#if defined( DAW_ALLOW_AVX2 )
+	if( host_cpu_features( ).avx2 and host_cpu_features( ).bmi1 ) {
+		check_kernel<avx2_exec_tag>( );
+	} else {
+		std::cout << "Skipping the avx2 escape scan, the host does not support it\n";
+	}
+#endif
+
+	constexpr char const specials[] = { '"', '\\', '\n', '\t', '\x01', '\x1F' };
+	// Put each special character at every offset of strings long enough to
+	// cover the block and tail paths
+	for( std::size_t len = 0; len < 80; ++len ) {
+		for( std::size_t pos = 0; pos <= len; ++pos ) {
+			for( char special : specials ) {
+				auto value = std::string( len, 'a' );
+				if( pos < len ) {
+					value[pos] = special;
+				}
+				ensure( to_json( value ) == escape_ascii( value ) );
+				ensure(
+				  to_json( value,
+				           options::output_flags<
+				             options::RestrictedStringOutput::OnlyAllow7bitsStrings> ) ==
+				  escape_ascii( value ) );
+				ensure( from_json<std::string>( to_json( value ) ) == value );
+			}
+		}
+	}
+
+	auto const long_value = std::string( 1000, 'x' ) + "\"end\"";
+	ensure( to_json( long_value ) == escape_ascii( long_value ) );
+
+	// High bytes are copied as is unless output is restricted to 7 bits
+	auto const utf8_value =
+	  std::string( 40, ' ' ) + "caf\xC3\xA9 \xF0\x9F\x98\x8D\x7F" + "\n";
+	ensure( to_json( utf8_value ) ==
+	        "\"" + std::string( 40, ' ' ) + "caf\xC3\xA9 \xF0\x9F\x98\x8D\x7F" +
+	          "\\n\"" );
+	ensure( to_json( utf8_value,
+	                 options::output_flags<
+	                   options::RestrictedStringOutput::OnlyAllow7bitsStrings> ) ==
+	        "\"" + std::string( 40, ' ' ) +
+	          "caf\\u00E9 \\uD83D\\uDE0D\\u007F\\n\"" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,168 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_exec_dispatch.h>
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct Element {
+	int a;
+	std::string b;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Element> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type =
+		  json_member_list<json_link<a, int>, json_link<b, std::string>>;
+
+		static constexpr auto to_json_data( Element const &e ) {
+			return std::forward_as_tuple( e.a, e.b );
+		}
+	};
+} // namespace daw::json
+
+/// The exec modes that are compiled in and that the host supports
+static std::vector<daw::json::options::ExecModeTypes> host_exec_modes( ) {
+	using daw::json::options::ExecModeTypes;
+	auto const &features = daw::json::host_cpu_features( );
+	(void)features;
+	auto result = std::vector<ExecModeTypes>{ ExecModeTypes::compile_time };
+#if defined( DAW_ALLOW_SSE42 )
+	if( features.sse42 and features.pclmul ) {
+		result.push_back( ExecModeTypes::simd );
+	}
+#endif
+#if defined( DAW_ALLOW_AVX2 )
+	if( features.avx2 and features.bmi1 and features.sse42 and
+	    features.pclmul ) {
+		result.push_back( ExecModeTypes::avx2 );
+	}
+#endif
+	return result;
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	auto const mode = dispatch_exec_mode( );
+	std::cout << "Dispatching to the " << options::to_string( mode )
+	          << " exec mode\n";
+	ensure( mode == dispatch_exec_mode( ) );
+	auto const modes = host_exec_modes( );
+	ensure( mode == modes.back( ) );
+
+	// The selection for hosts other than this one
+	{
+		using json_details::select_exec_mode;
+		auto const none = cpu_features{ };
+		auto const sse42 = cpu_features{ true, true, false, false };
+		auto const avx2 = cpu_features{ true, true, true, true };
+		ensure( select_exec_mode( none ) == options::ExecModeTypes::compile_time );
+#if defined( DAW_ALLOW_SSE42 )
+		ensure( select_exec_mode( sse42 ) == options::ExecModeTypes::simd );
+#else
+		ensure( select_exec_mode( sse42 ) ==
+		        options::ExecModeTypes::compile_time );
+#endif
+#if defined( DAW_ALLOW_AVX2 )
+		ensure( select_exec_mode( avx2 ) == options::ExecModeTypes::avx2 );
+#elif defined( DAW_ALLOW_SSE42 )
+		ensure( select_exec_mode( avx2 ) == options::ExecModeTypes::simd );
+#else
+		ensure( select_exec_mode( avx2 ) ==
+		        options::ExecModeTypes::compile_time );
+#endif
+	}
+
+	// Long enough strings and whitespace runs to go through the vector kernels
+	std::string const json_doc = R"json(
+{
+                                                        "b": "a string that is longer than thirty-two bytes, with an \"escape\"",
+                                                        "a": 1
+}
+)json";
+	auto const expected = from_json<Element>( json_doc );
+	auto const e = from_json_dispatch<Element>( json_doc );
+	ensure( e.a == expected.a );
+	ensure( e.b == expected.b );
+	auto const e2 = from_json_dispatch<Element>(
+	  json_doc, options::parse_flags<options::CheckedParseMode::no> );
+	ensure( e2.b == expected.b );
+
+	std::string const json_ary = "[" + json_doc + "," + json_doc + "]";
+	auto const ary = from_json_array_dispatch<Element>( json_ary );
+	ensure( ary.size( ) == 2 );
+	ensure( ary[1].b == expected.b );
+
+	constexpr daw::string_view json_lines = R"json(
+{"a":1,"b":"x"}
+{"a":2,"b":"y"}
+)json";
+	auto const sum = json_lines_dispatch<Element>( json_lines, []( auto rng ) {
+		int result = 0;
+		for( Element const &line : rng ) {
+			result += line.a;
+		}
+		return result;
+	} );
+	ensure( sum == 3 );
+
+	// Force each mode the host supports, not only the one dispatched to
+	for( auto const forced : modes ) {
+		std::cout << "Checking the " << options::to_string( forced )
+		          << " exec mode\n";
+		json_details::exec_mode_dispatch( forced, [&]( auto m ) {
+			constexpr auto exec_mode = decltype( m )::value;
+			ensure( exec_mode == forced );
+			auto const fe = from_json<Element>(
+			  json_doc, options::parse_flags<exec_mode> );
+			ensure( fe.a == expected.a );
+			ensure( fe.b == expected.b );
+			auto const fe2 = from_json<Element>(
+			  json_doc,
+			  options::parse_flags<exec_mode, options::CheckedParseMode::no> );
+			ensure( fe2.b == expected.b );
+			auto const fary = from_json_array<Element>(
+			  json_ary, options::parse_flags<exec_mode> );
+			ensure( fary.size( ) == 2 );
+			ensure( fary[0].b == expected.b );
+			ensure( fary[1].b == expected.b );
+			int fsum = 0;
+			for( Element const &line :
+			     json_lines_range<Element, exec_mode>( json_lines ) ) {
+				fsum += line.a;
+			}
+			ensure( fsum == 3 );
+		} );
+	}
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,104 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_extract_paths.h>
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+static constexpr char const user_name_path[] = "/statuses/1/user/name";
+static constexpr char const count_path[] = "/search_metadata/count";
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr std::string_view json_doc = R"(
+	{
+		"search_metadata": { "count": 2, "skip": [ { "x": [ 1, 2, { "id": 0 } ] } ] },
+		"statuses": [
+			{ "id": 10, "text": "first \"}]", "user": { "name": "a", "id": 1 } },
+			{ "id": 11, "text": "second", "user": { "name": "b", "id": 42 } }
+		],
+		"dup": 1,
+		"dup": 2,
+		"tail": [ 9, 9, 9 ]
+	})";
+
+	auto const text_ptr = runtime_json_pointer( "/statuses/0/text" );
+	auto const missing_ptr = runtime_json_pointer( "/statuses/2/id" );
+	{
+		auto [name, count, text, missing, dup] =
+		  extract_paths<std::string, int, std::string, std::optional<int>, int>(
+		    json_doc, json_pointer<user_name_path>, json_pointer<count_path>,
+		    text_ptr, missing_ptr, runtime_json_pointer( "/dup" ) );
+		ensure( name == "b" );
+		ensure( count == 2 );
+		ensure( text == "first \"}]" );
+		ensure( not missing );
+		// The first of duplicate members is used, as with json_value
+		ensure( dup == 1 );
+	}
+	{
+		// Paths in any order, sharing prefixes, and raw json_value results
+		auto const jv = json_value( json_doc );
+		auto [id1, id0, statuses, whole, none] = extract_paths(
+		  jv, runtime_json_pointer( "/statuses/1/id" ),
+		  runtime_json_pointer( "/statuses/0/id" ),
+		  runtime_json_pointer( "/statuses" ), runtime_json_pointer( "" ),
+		  missing_ptr );
+		ensure( id1.as<int>( ) == 11 );
+		ensure( id0.as<int>( ) == 10 );
+		ensure( statuses.is_array( ) );
+		ensure( statuses.get_raw_state( ).first ==
+		        jv["statuses"].get_raw_state( ).first );
+		ensure( whole.is_class( ) );
+		ensure( not none );
+	}
+	{
+		auto [x, past_scalar] = extract_paths(
+		  json_doc, runtime_json_pointer( "/search_metadata/skip/0/x/2/id" ),
+		  runtime_json_pointer( "/search_metadata/count/0" ) );
+		ensure( x.as<int>( ) == 0 );
+		ensure( not past_scalar );
+	}
+	static_assert( std::tuple_size_v<decltype( extract_paths( json_doc ) )> ==
+	               0 );
+
+#ifdef DAW_USE_EXCEPTIONS
+	bool has_error = false;
+	try {
+		(void)extract_paths<int>( json_doc, missing_ptr );
+	} catch( json_exception const &jex ) {
+		has_error = jex.reason_type( ) == ErrorReason::JSONPathNotFound;
+	}
+	ensure( has_error );
+#endif
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,106 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+template<typename Integer>
+void check_output( Integer value ) {
+	ensure( daw::json::to_json( value ) == std::to_string( value ) );
+	ensure( daw::json::from_json<Integer>( daw::json::to_json( value ) ) ==
+	        value );
+}
+
+template<typename Integer>
+void check_type( ) {
+	check_output( std::numeric_limits<Integer>::min( ) );
+	check_output( std::numeric_limits<Integer>::max( ) );
+	check_output( Integer{ 0 } );
+	// Values on either side of each power of ten
+	for( Integer p = 1; p <= std::numeric_limits<Integer>::max( ) / 10;
+	     p = static_cast<Integer>( p * 10 ) ) {
+		check_output( static_cast<Integer>( p - 1 ) );
+		check_output( p );
+		check_output( static_cast<Integer>( p + 1 ) );
+		if constexpr( std::numeric_limits<Integer>::is_signed ) {
+			check_output( static_cast<Integer>( -p ) );
+			check_output( static_cast<Integer>( 1 - p ) );
+		}
+	}
+}
+
+#if not defined( DAW_JSON_NO_INT128 ) and defined( DAW_HAS_INT128 ) and \
+  ( not defined( _MSC_VER ) ) and                                       \
+  ( not defined( __clang__ ) and not defined( _LIBCPP_VERSION ) or      \
+    __clang_major__ > 9 )
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+void check_int128( ) {
+	using namespace daw::json;
+	constexpr std::string_view json_doc =
+	  "[170141183460469231731687303715884105727,-"
+	  "170141183460469231731687303715884105728,10000000000000000000,-"
+	  "10000000000000000000000000000000000000,0,-1]";
+	auto const values =
+	  from_json_array<json_number_no_name<__int128>>( json_doc );
+	ensure( to_json_array<json_number_no_name<__int128>>( values ) == json_doc );
+}
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+#define DAW_JSON_TEST_INT128
+#endif
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	check_type<short>( );
+	check_type<unsigned short>( );
+	check_type<int>( );
+	check_type<unsigned>( );
+	check_type<long long>( );
+	check_type<unsigned long long>( );
+
+	using namespace daw::json;
+	ensure(
+	  to_json_array<json_number_no_name<std::int64_t,
+	                                    options::number_opt(
+	                                      options::LiteralAsStringOpt::Always )>>(
+	    std::vector<std::int64_t>{ -12, 0, 1700000000000 } ) ==
+	  R"(["-12","0","1700000000000"])" );
+
+#if defined( DAW_JSON_TEST_INT128 )
+	check_int128( );
+#endif
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
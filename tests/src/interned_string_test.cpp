@@ -0,0 +1,101 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_interned_string.h>
+#include <daw/json/daw_json_lines_iterator.h>
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+struct Event {
+	daw::json::interned_string status;
+	daw::json::interned_string host;
+	int id;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Event> {
+		static constexpr char const status[] = "status";
+		static constexpr char const host[] = "host";
+		static constexpr char const id[] = "id";
+		using type = json_member_list<json_link<status, interned_string>,
+		                              json_string<host, interned_string>,
+		                              json_link<id, int>>;
+
+		static constexpr auto to_json_data( Event const &e ) {
+			return std::forward_as_tuple( e.status, e.host, e.id );
+		}
+	};
+} // namespace daw::json
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr std::string_view statuses[] = { "ok", "error", R"(\"quoted\")" };
+	constexpr std::string_view hosts[] = { "alpha.example.com",
+	                                       "beta.example.com" };
+	std::string jsonl_doc;
+	for( int n = 0; n < 300; ++n ) {
+		jsonl_doc += R"({"status":")";
+		jsonl_doc += statuses[n % 3];
+		jsonl_doc += R"(","host":")";
+		jsonl_doc += hosts[n % 2];
+		jsonl_doc += R"(","id":)" + std::to_string( n ) + "}\n";
+	}
+
+	auto events = std::vector<Event>( );
+	for( Event e : json_lines_range<Event>( jsonl_doc ) ) {
+		events.push_back( e );
+	}
+	ensure( events.size( ) == 300 );
+	for( std::size_t n = 0; n < events.size( ); ++n ) {
+		auto const &e = events[n];
+		ensure( e.id == static_cast<int>( n ) );
+		ensure( e.host == hosts[n % 2] );
+		// Equal values share the same storage
+		ensure( e.status == events[n % 3].status );
+		ensure( e.status.data( ) == events[n % 3].status.data( ) );
+		ensure( e.host.data( ) == events[n % 2].host.data( ) );
+	}
+	ensure( events[0].status == "ok" );
+	ensure( events[2].status == R"("quoted")" );
+	ensure( events[0].status != events[1].status );
+	ensure( json_string_pool::global( ).size( ) == 5 );
+
+	auto const json_doc = to_json( events[2] );
+	ensure( json_doc ==
+	        R"({"status":"\"quoted\"","host":"alpha.example.com","id":2})" );
+	auto const e2 = from_json<Event>( json_doc );
+	ensure( e2.status == events[2].status and e2.host == events[2].host );
+	ensure( interned_string( std::string_view( "ok" ) ) == events[0].status );
+	ensure( interned_string( ).empty( ) );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
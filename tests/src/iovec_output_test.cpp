@@ -0,0 +1,126 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_iovec_output.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+struct Blob {
+	std::string name;
+	std::string payload;
+	std::string_view raw;
+	int id;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Blob> {
+		static constexpr char const name[] = "name";
+		static constexpr char const payload[] = "payload";
+		static constexpr char const raw[] = "raw";
+		static constexpr char const id[] = "id";
+		using type =
+		  json_member_list<json_string<name>, json_string<payload>,
+		                   json_string_raw<raw, std::string_view>,
+		                   json_number<id, int>>;
+
+		static auto to_json_data( Blob const &v ) {
+			return std::forward_as_tuple( v.name, v.payload, v.raw, v.id );
+		}
+	};
+} // namespace daw::json
+
+template<typename Value>
+bool is_referenced( daw::json::json_iovec_output const &out,
+                    Value const &value ) {
+	for( auto const &part : out.parts( ) ) {
+		if( part.data <= value.data( ) and
+		    value.data( ) + value.size( ) <= part.data + part.size ) {
+			return true;
+		}
+	}
+	return false;
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	auto const raw_text = std::string( 2000, 'r' );
+	auto const blob = Blob{ "short \"name\"", std::string( 5000, 'p' ) + "\n",
+	                        raw_text, 7 };
+	auto const expected = to_json( blob );
+
+	auto out = json_iovec_output( );
+	(void)to_json( blob, out );
+	ensure( out.to_string( ) == expected );
+	ensure( out.size( ) == expected.size( ) );
+	// The long runs are referenced, the short name is staged
+	ensure( is_referenced( out, raw_text ) );
+	ensure( is_referenced( out, std::string_view( blob.payload.data( ), 5000 ) ) );
+	ensure( not is_referenced( out, blob.name ) );
+
+	auto copy = std::string( );
+	out.write_to( copy );
+	ensure( copy == expected );
+
+	out.clear( );
+	ensure( out.size( ) == 0 and out.parts( ).empty( ) );
+	(void)to_json( blob, out,
+	               options::output_flags<options::SerializationFormat::Pretty> );
+	ensure( out.to_string( ) ==
+	        to_json( blob, options::output_flags<
+	                         options::SerializationFormat::Pretty> ) );
+
+	{
+		// Everything is staged when the threshold is out of reach
+		auto staged = json_iovec_output( 1'000'000 );
+		(void)to_json( blob, staged );
+		ensure( staged.to_string( ) == expected );
+		ensure( not is_referenced( staged, raw_text ) );
+	}
+#if defined( DAW_JSON_HAS_WRITEV )
+	{
+		std::FILE *f = std::tmpfile( );
+		ensure( f != nullptr );
+		out.clear( );
+		(void)to_json( blob, out );
+		out.writev( fileno( f ) );
+		ensure( out.size( ) == 0 );
+		std::rewind( f );
+		auto result = std::string( expected.size( ), '\0' );
+		ensure( std::fread( result.data( ), 1, result.size( ), f ) ==
+		        result.size( ) );
+		std::fclose( f );
+		ensure( result == expected );
+	}
+#endif
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,122 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_file.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+struct Point {
+	int x;
+	int y;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Point> {
+		static constexpr char const x[] = "x";
+		static constexpr char const y[] = "y";
+		using type = json_member_list<json_link<x, int>, json_link<y, int>>;
+
+		static constexpr auto to_json_data( Point const &p ) {
+			return std::forward_as_tuple( p.x, p.y );
+		}
+	};
+} // namespace daw::json
+
+void write_file( std::string const &path, std::string const &data ) {
+	std::FILE *f = std::fopen( path.c_str( ), "wb" );
+	ensure( f != nullptr );
+	ensure( std::fwrite( data.data( ), 1, data.size( ), f ) == data.size( ) );
+	std::fclose( f );
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	auto const path = std::string( "json_file_test.json" );
+
+	auto points = std::vector<Point>( );
+	std::string jsonl_doc;
+	for( int n = 0; n < 500; ++n ) {
+		points.push_back( Point{ n, -n } );
+		jsonl_doc += to_json( points.back( ) ) + '\n';
+	}
+	write_file( path, to_json_array( points ) );
+	auto const parsed = from_json_file<std::vector<Point>>( path );
+	ensure( parsed.size( ) == points.size( ) );
+	for( std::size_t n = 0; n < parsed.size( ); ++n ) {
+		ensure( parsed[n].x == points[n].x and parsed[n].y == points[n].y );
+	}
+	ensure( from_json_file<std::vector<Point>>(
+	          path, options::parse_flags<options::CheckedParseMode::no>,
+	          JsonFileHugePages::yes )
+	          .size( ) == points.size( ) );
+
+	write_file( path, jsonl_doc );
+	int count = 0;
+	for( Point p : json_lines_file_range<Point>( path ) ) {
+		ensure( p.x == count and p.y == -count );
+		++count;
+	}
+	ensure( count == 500 );
+
+	// A document that fills whole pages must still be followed by zeros
+	auto page_doc = std::string( 8192, ' ' );
+	page_doc.front( ) = '"';
+	page_doc.back( ) = '"';
+	write_file( path, page_doc );
+	{
+		auto const file = json_mapped_file( path );
+		ensure( file.size( ) == page_doc.size( ) );
+		for( std::size_t n = 0; n < json_file_padding; ++n ) {
+			ensure( file.data( )[file.size( ) + n] == '\0' );
+		}
+		ensure( from_json<std::string_view>( file ).size( ) == 8190 );
+	}
+
+	write_file( path, "" );
+	ensure( json_lines_file_range<Point>( path ).begin( ) ==
+	        json_lines_file_range<Point>( path ).end( ) );
+	std::remove( path.c_str( ) );
+
+#ifdef DAW_USE_EXCEPTIONS
+	bool has_error = false;
+	try {
+		(void)from_json_file<Point>( "json_file_test_missing.json" );
+	} catch( json_exception const &jex ) {
+		has_error = jex.reason_type( ) == ErrorReason::InputError;
+	}
+	ensure( has_error );
+#endif
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,143 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_lazy.h>
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Payload {
+	int id;
+	std::vector<int> values;
+};
+
+struct Gateway {
+	std::string route;
+	daw::json::json_lazy_value<Payload> payload;
+	daw::json::json_lazy_value<std::string> note;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Payload> {
+#if defined( DAW_JSON_CNTTP_JSON_NAME )
+		using type = json_member_list<json_number<"id", int>,
+		                              json_array<"values", int>>;
+#else
+		static constexpr char const id[] = "id";
+		static constexpr char const values[] = "values";
+		using type =
+		  json_member_list<json_number<id, int>, json_array<values, int>>;
+#endif
+		static auto to_json_data( Payload const &value ) {
+			return std::forward_as_tuple( value.id, value.values );
+		}
+	};
+
+	template<>
+	struct json_data_contract<Gateway> {
+#if defined( DAW_JSON_CNTTP_JSON_NAME )
+		using type =
+		  json_member_list<json_string<"route">, json_lazy<"payload", Payload>,
+		                   json_lazy<"note", std::string>>;
+#else
+		static constexpr char const route[] = "route";
+		static constexpr char const payload[] = "payload";
+		static constexpr char const note[] = "note";
+		using type = json_member_list<json_string<route>,
+		                              json_lazy<payload, Payload>,
+		                              json_lazy<note, std::string>>;
+#endif
+		static auto to_json_data( Gateway const &value ) {
+			return std::forward_as_tuple( value.route, value.payload, value.note );
+		}
+	};
+} // namespace daw::json
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr std::string_view json_doc =
+	  R"({"note":"a \"quoted\" note","route":"/a","payload":{ "values": [1, 2,3], "id": 5 }})";
+
+	auto gw = from_json<Gateway>( json_doc );
+	ensure( gw.route == "/a" );
+	ensure( not gw.payload.has_value( ) );
+	ensure( gw.payload.get_raw( ) == R"({ "values": [1, 2,3], "id": 5 })" );
+	// String values keep their quotes
+	ensure( gw.note.get_raw( ) == R"("a \"quoted\" note")" );
+
+	// Untouched members are written back verbatim
+	ensure(
+	  to_json( gw ) ==
+	  R"({"route":"/a","payload":{ "values": [1, 2,3], "id": 5 },"note":"a \"quoted\" note"})" );
+
+	// Parsed on first access and cached
+	ensure( gw.payload->id == 5 );
+	ensure( gw.payload.has_value( ) );
+	ensure( gw.payload.get( ).values.size( ) == 3 );
+	ensure( *gw.note == R"(a "quoted" note)" );
+
+	// Accessed members are serialized from the value
+	gw.payload->values.push_back( 4 );
+	ensure(
+	  to_json( gw ) ==
+	  R"({"route":"/a","payload":{"id":5,"values":[1,2,3,4]},"note":"a \"quoted\" note"})" );
+
+	auto const made = Gateway{ "/b", json_lazy_value<Payload>( Payload{ 1, { } } ),
+	                           json_lazy_value<std::string>( "x" ) };
+	ensure( to_json( made ) ==
+	        R"({"route":"/b","payload":{"id":1,"values":[]},"note":"x"})" );
+
+	// An element of an array
+	auto const notes =
+	  from_json_array<json_lazy_no_name<std::string>>( R"([1, "b"])" );
+	ensure( notes.size( ) == 2 );
+	ensure( notes[0].get_raw( ) == "1" );
+	ensure( notes[1].get_raw( ) == R"("b")" );
+	ensure( notes[1].get( ) == "b" );
+
+	// A null value has an empty raw range and is written back as null
+	auto const nulled =
+	  from_json<Gateway>( R"({"route":"/n","payload":null,"note":"y"})" );
+	ensure( nulled.payload.get_raw( ).empty( ) );
+	ensure( nulled.note.get_raw( ) == R"("y")" );
+	ensure( to_json( nulled ) == R"({"route":"/n","payload":null,"note":"y"})" );
+	auto const null_notes =
+	  from_json_array<json_lazy_no_name<std::string>>( R"([null, "b"])" );
+	ensure( null_notes.size( ) == 2 );
+	ensure( null_notes[0].get_raw( ).empty( ) );
+	ensure( null_notes[1].get_raw( ) == R"("b")" );
+
+	// A value at the start of the document
+	auto const top = from_json<json_lazy_no_name<std::string>>( R"("top")" );
+	ensure( top.get_raw( ) == R"("top")" );
+	ensure( top.get( ) == "top" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -17,6 +17,7 @@
 #include <daw/daw_memory_mapped_file.h>
 #include <daw/json/daw_json_lines_iterator.h>
 #include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_parallel.h>
 
 #include <cstdlib>
 #include <future>
@@ -175,4 +176,20 @@ int main( int argc, char **argv ) {
 	  unchkpartitions );
 	ensure( typed_unchecked_threaded_count.has_value( ) );
 	ensure( typed_unchecked_threaded_count.get( ) == real_count.get( ) );
+
+	auto typed_checked_parallel_count = daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS * 10, jsonl_doc.size( ), "json_lines typed parallel checked",
+	  []( daw::string_view jd ) {
+		  return daw::json::reduce_jsonl_parallel<jsonl_entry>(
+		    jd, std::size_t{ 0 },
+		    []( std::size_t c, jsonl_entry entry ) {
+			    return c + entry.body.size( );
+		    },
+		    []( std::size_t lhs, std::size_t rhs ) {
+			    return lhs + rhs;
+		    } );
+	  },
+	  jsonl_doc );
+	ensure( typed_checked_parallel_count.has_value( ) );
+	ensure( typed_checked_parallel_count.get( ) == real_count.get( ) );
 }
@@ -0,0 +1,101 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_pointer.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+
+static constexpr char const user_id_path[] = "/statuses/1/user/id";
+static constexpr char const escaped_path[] = "/a~1b/m~0n";
+static constexpr char const root_path[] = "";
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr std::string_view json_doc = R"(
+	{
+		"search_metadata": { "count": 2, "skip": [ { "x": [ 1, 2, { "id": 0 } ] } ] },
+		"statuses": [
+			{ "text": "first \"}]", "user": { "name": "a", "id": 1 } },
+			{ "text": "second", "user": { "name": "b", "id": 42 } }
+		],
+		"a/b": { "m~n": "escaped" },
+		"": { "": "empty" },
+		"0": "zero"
+	})";
+
+	constexpr auto const &user_id = json_pointer<user_id_path>;
+	static_assert( user_id.size( ) == 4 );
+	static_assert( user_id.segment( 1 ).index == 1 );
+	static_assert( user_id.segment_name( user_id.segment( 2 ) ) == "user" );
+	ensure( user_id.find( json_doc ).as<int>( ) == 42 );
+	ensure( json_pointer<escaped_path>.find( json_doc ).as<std::string>( ) ==
+	        "escaped" );
+	ensure( json_pointer<root_path>.find( json_doc ).is_class( ) );
+
+	auto const jv = json_value( json_doc );
+	ensure( user_id.find( jv ).get_raw_state( ).first ==
+	        jv["statuses[1].user.id"].get_raw_state( ).first );
+
+	ensure( runtime_json_pointer( "/statuses/0/user/name" )
+	          .find( json_doc )
+	          .as<std::string>( ) == "a" );
+	ensure( runtime_json_pointer( "/statuses/0/text" )
+	          .find( json_doc )
+	          .as<std::string>( ) == "first \"}]" );
+	ensure( runtime_json_pointer( "//" ).find( json_doc ).as<std::string>( ) ==
+	        "empty" );
+	// Numeric tokens are member names in a class
+	ensure( runtime_json_pointer( "/0" ).find( json_doc ).as<std::string>( ) ==
+	        "zero" );
+
+	// Missing values
+	for( std::string_view path :
+	     { "/statuses/2", "/statuses/01", "/statuses/-", "/statuses/x",
+	       "/missing", "/statuses/0/text/x", "/search_metadata/count/0" } ) {
+		ensure( not runtime_json_pointer( path ).find( json_doc ) );
+	}
+
+	// A compiled pointer can be used on many documents
+	auto const name = runtime_json_pointer( "/user/name" );
+	ensure( name.find( R"({"user":{"name":"x"}})" ).as<std::string>( ) == "x" );
+	ensure( name.find( R"({"id":5,"user":{"id":1,"name":"y"}})" )
+	          .as<std::string>( ) == "y" );
+
+#ifdef DAW_USE_EXCEPTIONS
+	for( std::string_view bad : { "a/b", "/~2", "/x~" } ) {
+		bool has_error = false;
+		try {
+			(void)runtime_json_pointer( bad );
+		} catch( json_exception const & ) { has_error = true; }
+		ensure( has_error );
+	}
+#endif
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
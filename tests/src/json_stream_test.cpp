@@ -0,0 +1,146 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_stream.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct Element {
+	int a;
+	std::string b;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Element> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type =
+		  json_member_list<json_link<a, int>, json_link<b, std::string>>;
+
+		static constexpr auto to_json_data( Element const &e ) {
+			return std::forward_as_tuple( e.a, e.b );
+		}
+	};
+} // namespace daw::json
+
+template<typename Stream>
+std::vector<Element> read_all( Stream &&stream ) {
+	auto result = std::vector<Element>( );
+	for( auto &e : stream ) {
+		result.push_back( e );
+	}
+	return result;
+}
+
+void check( std::vector<Element> const &result,
+            std::vector<Element> const &expected ) {
+	ensure( result.size( ) == expected.size( ) );
+	for( std::size_t n = 0; n < result.size( ); ++n ) {
+		ensure( result[n].a == expected[n].a );
+		ensure( result[n].b == expected[n].b );
+	}
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	auto expected = std::vector<Element>( );
+	std::string json_lines_doc;
+	for( int n = 0; n < 1000; ++n ) {
+		// Some elements are larger than the window and need it to grow
+		expected.push_back(
+		  Element{ n, std::string( n % 100 == 0 ? 300 : n % 13, 'x' ) + "\"],}" } );
+		json_lines_doc += to_json( expected.back( ) ) + ( n % 3 == 0 ? "\n\n" : "\n" );
+	}
+	auto const json_array_doc = to_json_array( expected );
+
+	// A small window makes elements span refills
+	{
+		auto in = std::istringstream( json_array_doc );
+		check( read_all( json_array_stream<Element>( json_source_from_istream( in ),
+		                                             64 ) ),
+		       expected );
+	}
+	{
+		auto in = std::istringstream( json_lines_doc );
+		check( read_all( json_lines_stream<Element>( json_source_from_istream( in ),
+		                                             64 ) ),
+		       expected );
+	}
+	{
+		auto in = std::istringstream( json_array_doc );
+		auto stream = json_array_stream<Element, options::CheckedParseMode::no>(
+		  json_source_from_istream( in ) );
+		int count = 0;
+		while( auto e = stream.next( ) ) {
+			ensure( e->a == count );
+			++count;
+		}
+		ensure( count == 1000 );
+		ensure( not stream.next_raw( ) );
+	}
+	{
+		auto in = std::istringstream( " [ ] " );
+		ensure( read_all( json_array_stream<Element>( json_source_from_istream( in ) ) )
+		          .empty( ) );
+	}
+
+	std::FILE *f = std::tmpfile( );
+	ensure( f != nullptr );
+	ensure( std::fwrite( json_array_doc.data( ), 1, json_array_doc.size( ), f ) ==
+	        json_array_doc.size( ) );
+	std::rewind( f );
+	check( read_all( json_array_stream<Element>( json_source_from_file( f ), 100 ) ),
+	       expected );
+#if __has_include( <unistd.h> )
+	std::rewind( f );
+	check( read_all( json_array_stream<Element>(
+	         json_source_from_fd( fileno( f ) ), 100 ) ),
+	       expected );
+#endif
+	std::fclose( f );
+
+#ifdef DAW_USE_EXCEPTIONS
+	bool has_error = false;
+	try {
+		auto in = std::istringstream( R"([{"a":1,"b":"x"},{"a":2,"b":"y"})" );
+		(void)read_all( json_array_stream<Element>( json_source_from_istream( in ) ) );
+	} catch( json_exception const &jex ) {
+		has_error = true;
+		ensure( jex.reason_type( ) == ErrorReason::UnexpectedEndOfData );
+	}
+	ensure( has_error );
+#endif
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,193 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Classes with enough members use a perfect hash to find member names.  Parse
+// the members out of order, with unknown members, to exercise it and the
+// member order prediction
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct Telemetry {
+	int m0;
+	int m1;
+	int m2;
+	int m3;
+	int m4;
+	int m5;
+	int m6;
+	int m7;
+	int m8;
+	int m9;
+	std::string m10;
+	std::optional<int> m11;
+};
+
+/// Records the order the members of Ordered are parsed in
+static std::vector<int> parse_log;
+
+struct Logged {
+	int v;
+
+	explicit Logged( int value )
+	  : v( value ) {
+		parse_log.push_back( value );
+	}
+};
+
+struct Ordered {
+	Logged a;
+	Logged b;
+	Logged c;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Telemetry> {
+		static constexpr char const m0[] = "m0";
+		static constexpr char const m1[] = "m1";
+		static constexpr char const m2[] = "m2";
+		static constexpr char const m3[] = "m3";
+		static constexpr char const m4[] = "m4";
+		static constexpr char const m5[] = "m5";
+		static constexpr char const m6[] = "m6";
+		static constexpr char const m7[] = "m7";
+		static constexpr char const m8[] = "m8";
+		static constexpr char const m9[] = "m9";
+		static constexpr char const m10[] = "a_much_longer_member_name_10";
+		static constexpr char const m11[] = "m11";
+		using type = json_member_list<
+		  json_link<m0, int>, json_link<m1, int>, json_link<m2, int>,
+		  json_link<m3, int>, json_link<m4, int>, json_link<m5, int>,
+		  json_link<m6, int>, json_link<m7, int>, json_link<m8, int>,
+		  json_link<m9, int>, json_link<m10, std::string>,
+		  json_link<m11, std::optional<int>>>;
+	};
+
+	template<>
+	struct json_data_contract<Logged> {
+		static constexpr char const v[] = "v";
+		using type = json_member_list<json_link<v, int>>;
+	};
+
+	template<>
+	struct json_data_contract<Ordered> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		static constexpr char const c[] = "c";
+		using type = json_member_list<json_link<a, Logged>, json_link<b, Logged>,
+		                              json_link<c, Logged>>;
+	};
+} // namespace daw::json
+
+template<typename... PolicyFlags>
+void check( std::string_view json_doc, PolicyFlags... flags ) {
+	auto const t = daw::json::from_json<Telemetry>( json_doc, flags... );
+	ensure( t.m0 == 0 );
+	ensure( t.m1 == 1 );
+	ensure( t.m2 == 2 );
+	ensure( t.m3 == 3 );
+	ensure( t.m4 == 4 );
+	ensure( t.m5 == 5 );
+	ensure( t.m6 == 6 );
+	ensure( t.m7 == 7 );
+	ensure( t.m8 == 8 );
+	ensure( t.m9 == 9 );
+	ensure( t.m10 == "ten" );
+	ensure( not t.m11 );
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr std::string_view in_order =
+	  R"({"m0":0,"m1":1,"m2":2,"m3":3,"m4":4,"m5":5,"m6":6,"m7":7,"m8":8,"m9":9,)"
+	  R"("a_much_longer_member_name_10":"ten"})";
+	constexpr std::string_view reversed =
+	  R"({"a_much_longer_member_name_10":"ten","m9":9,"m8":8,"m7":7,"m6":6,)"
+	  R"("m5":5,"m4":4,"m3":3,"m2":2,"m1":1,"m0":0})";
+	constexpr std::string_view with_unknown =
+	  R"({"m5":5,"x0":true,"m9":9,"m0":0,"m1":1,"m10":"no","m2":2,"m3":3,"m4":4,)"
+	  R"("a_much_longer_member_name_1":[1,2],"m6":6,"m7":7,"m8":8,)"
+	  R"("a_much_longer_member_name_10":"ten"})";
+
+	check( in_order );
+	check( reversed );
+	check( with_unknown );
+	check( reversed, options::parse_flags<options::CheckedParseMode::no> );
+	check( with_unknown, options::parse_flags<options::ExecModeTypes::runtime> );
+
+	// Learn one order, then switch orders so that predictions miss
+	for( auto doc : { reversed, reversed, with_unknown, with_unknown, in_order,
+	                  reversed } ) {
+		check( doc, options::parse_flags<options::PredictMemberOrder::yes> );
+		check( doc, options::parse_flags<options::PredictMemberOrder::yes,
+		                                 options::CheckedParseMode::no> );
+	}
+
+	// Once documents are learned to be out of order, members are parsed in
+	// document order instead of being skipped and parsed later
+	{
+		constexpr std::string_view c_a_b = R"({"c":{"v":3},"a":{"v":1},"b":{"v":2}})";
+		constexpr std::string_view a_b_c = R"({"a":{"v":1},"b":{"v":2},"c":{"v":3}})";
+		auto const parse_order = [&]( std::string_view doc, auto flags ) {
+			parse_log.clear( );
+			auto const o = daw::json::from_json<Ordered>( doc, flags );
+			ensure( o.a.v == 1 and o.b.v == 2 and o.c.v == 3 );
+			return parse_log;
+		};
+		constexpr auto predict =
+		  options::parse_flags<options::PredictMemberOrder::yes>;
+		ensure( parse_order( c_a_b, options::parse_flags<> ) ==
+		        std::vector<int>{ 1, 2, 3 } );
+		ensure( parse_order( c_a_b, predict ) == std::vector<int>{ 1, 2, 3 } );
+		ensure( parse_order( c_a_b, predict ) == std::vector<int>{ 3, 1, 2 } );
+		ensure( parse_order( c_a_b, predict ) == std::vector<int>{ 3, 1, 2 } );
+		// Without prediction the member list order is kept
+		ensure( parse_order( c_a_b, options::parse_flags<> ) ==
+		        std::vector<int>{ 1, 2, 3 } );
+		// An in order document switches back to member list order
+		ensure( parse_order( a_b_c, predict ) == std::vector<int>{ 1, 2, 3 } );
+		ensure( parse_order( c_a_b, predict ) == std::vector<int>{ 1, 2, 3 } );
+		ensure( parse_order( c_a_b, predict ) == std::vector<int>{ 3, 1, 2 } );
+		// Missing and duplicate members while parsing in document order
+		ensure( parse_order( R"({"c":{"v":3},"a":{"v":1},"c":{"v":4},"b":{"v":2}})",
+		                     predict ) == std::vector<int>{ 3, 1, 2 } );
+#ifdef DAW_USE_EXCEPTIONS
+		bool has_error = false;
+		try {
+			(void)parse_order( R"({"c":{"v":3},"a":{"v":1}})", predict );
+		} catch( daw::json::json_exception const & ) { has_error = true; }
+		ensure( has_error );
+#endif
+	}
+
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,112 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Series {
+	std::vector<std::int64_t> timestamps;
+	std::vector<double> values;
+	std::vector<std::vector<double>> points;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Series> {
+		static constexpr char const timestamps[] = "timestamps";
+		static constexpr char const values[] = "values";
+		static constexpr char const points[] = "points";
+		using type = json_member_list<json_array<timestamps, std::int64_t>,
+		                              json_array<values, double>,
+		                              json_array<points, std::vector<double>>>;
+	};
+} // namespace daw::json
+
+template<typename T>
+bool parse_fails( std::string_view json_doc ) {
+#ifdef DAW_USE_EXCEPTIONS
+	try {
+		(void)daw::json::from_json<T>( json_doc );
+	} catch( daw::json::json_exception const & ) { return true; }
+	return false;
+#else
+	(void)json_doc;
+	return true;
+#endif
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr std::string_view json_doc = R"json({
+	"timestamps": [ 1700000000000, -1700000000001 , 0,12345678901234567 ],
+	"values": [-1.5e3,0.1234567890123456,  123456789012.25,1e-7 ],
+	"points": [ [ -65.613616999999977, 43.420273000000009 ], [], [ 1 ] ]
+})json";
+
+	auto const s = from_json<Series>( json_doc );
+	ensure( s.timestamps == std::vector<std::int64_t>{
+	                          1700000000000, -1700000000001, 0, 12345678901234567 } );
+	ensure( s.values.size( ) == 4 );
+	ensure( s.values[0] == -1.5e3 );
+	ensure( s.values[2] == 123456789012.25 );
+	ensure( s.points.size( ) == 3 );
+	ensure( s.points[1].empty( ) );
+	ensure( s.points[2] == std::vector<double>{ 1.0 } );
+
+	// Counted and allocated once when asked for
+	auto const presized =
+	  from_json<Series>( json_doc, options::parse_flags<options::PresizeArrays::yes> );
+	ensure( presized.timestamps == s.timestamps );
+	ensure( presized.timestamps.capacity( ) == 4 );
+	ensure( presized.points[0].capacity( ) == 2 );
+	ensure( presized.points[1].empty( ) );
+
+	// Long runs of digits are decoded 8 at a time, check them against strtod
+	constexpr char const *long_numbers[] = {
+	  "0.12345678901234567", "98765432.123456789",  "-1234567890123456.5",
+	  "3.1415926535897932",  "0.000000012345678901", "12345678.87654321e-5" };
+	for( auto const *number : long_numbers ) {
+		auto const expected = std::strtod( number, nullptr );
+		auto const v = from_json<std::vector<double>>(
+		  "[" + std::string( number ) + "]",
+		  options::parse_flags<options::IEEE754Precise::yes> );
+		ensure( v.size( ) == 1 and v[0] == expected );
+	}
+
+	ensure( from_json<std::vector<int>>( "[]" ).empty( ) );
+	ensure( from_json<std::vector<unsigned>>( " [ 1 ,2 , 3 ] " ) ==
+	        std::vector<unsigned>{ 1, 2, 3 } );
+	ensure( parse_fails<std::vector<int>>( "[1,2," ) );
+	ensure( parse_fails<std::vector<int>>( "[1 2]" ) );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
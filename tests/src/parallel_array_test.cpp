@@ -0,0 +1,184 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_parallel.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct Element {
+	int id;
+	std::string name;
+	std::vector<double> values;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Element> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const values[] = "values";
+		using type =
+		  json_member_list<json_link<id, int>, json_link<name, std::string>,
+		                   json_link<values, std::vector<double>>>;
+
+		static constexpr auto to_json_data( Element const &e ) {
+			return std::forward_as_tuple( e.id, e.name, e.values );
+		}
+	};
+} // namespace daw::json
+
+/// Runs every task on the calling thread, in order
+struct serial_executor {
+	template<typename Task>
+	void operator( )( std::size_t task_count, Task &&task ) const {
+		for( std::size_t n = 0; n < task_count; ++n ) {
+			task( n );
+		}
+	}
+};
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	auto elements = std::vector<Element>( );
+	for( int n = 0; n < 5000; ++n ) {
+		elements.push_back( Element{
+		  n, "element " + std::to_string( n ),
+		  std::vector<double>( static_cast<std::size_t>( n % 7 ), 1.5 * n ) } );
+	}
+	auto const json_doc = to_json_array( elements );
+
+	auto const expected = from_json_array<Element>( json_doc );
+	auto const check = [&]( std::vector<Element> const &result ) {
+		ensure( result.size( ) == expected.size( ) );
+		for( std::size_t n = 0; n < result.size( ); ++n ) {
+			ensure( result[n].id == expected[n].id );
+			ensure( result[n].name == expected[n].name );
+			ensure( result[n].values == expected[n].values );
+		}
+	};
+	check( from_json_array_parallel<Element>( json_doc ) );
+	check(
+	  from_json_array_parallel<Element>( json_doc, json_thread_executor( 3 ) ) );
+	check( from_json_array_parallel<Element>( json_doc, serial_executor{ } ) );
+	check( from_json_array_parallel<Element>(
+	  json_doc, json_thread_executor( 4 ),
+	  options::parse_flags<options::CheckedParseMode::no> ) );
+
+	// Serializing in parallel must give the same document
+	ensure( to_json_array_parallel( elements ) == json_doc );
+	ensure( to_json_array_parallel( elements, serial_executor{ } ) == json_doc );
+	{
+		constexpr auto pretty =
+		  options::output_flags<options::SerializationFormat::Pretty,
+		                        options::IndentationType::Space2>;
+		ensure( to_json_array_parallel( elements, json_thread_executor( 3 ),
+		                                pretty ) ==
+		        to_json_array( elements, pretty ) );
+		auto out = std::vector<char>( );
+		(void)to_json_array_parallel( elements, out, json_thread_executor( 5 ),
+		                              pretty );
+		ensure( std::string( out.begin( ), out.end( ) ) ==
+		        to_json_array( elements, pretty ) );
+	}
+#ifdef DAW_USE_EXCEPTIONS
+	{
+		char *null_output = nullptr;
+		bool has_null_error = false;
+		try {
+			(void)to_json_array_parallel( elements, null_output,
+			                              json_thread_executor( 3 ) );
+		} catch( json_exception const &jex ) {
+			has_null_error = jex.reason_type( ) == ErrorReason::InvalidNull;
+		}
+		ensure( has_null_error );
+	}
+#endif
+	ensure( to_json_array_parallel( std::vector<int>{ } ) == "[]" );
+	ensure( to_json_array_parallel( std::vector<int>{ 1, 2, 3 } ) == "[1,2,3]" );
+
+	{
+		// The array is split by byte offset, the splits land inside of strings
+		// holding separators, brackets and escapes, and inside of nested arrays
+		auto tricky = std::vector<std::vector<std::string>>( );
+		for( int n = 0; n < 20000; ++n ) {
+			auto const s = std::to_string( n );
+			tricky.push_back( { "a,\\" + s + "\"],[{", "\\", s + "}]\\\"," } );
+		}
+		auto const tricky_doc = to_json_array( tricky ) + " \n";
+		for( unsigned threads : { 1U, 2U, 3U, 8U, 33U } ) {
+			ensure( from_json_array_parallel<std::vector<std::string>>(
+			          tricky_doc, json_thread_executor( threads ) ) == tricky );
+		}
+		ensure( from_json_array_parallel<std::vector<std::string>>(
+		          tricky_doc, serial_executor{ } ) == tricky );
+	}
+
+	ensure( from_json_array_parallel<int>( std::string( " [ ] " ) ).empty( ) );
+	auto const ints = from_json_array_parallel<int>( std::string( "[1, 2,3 ]" ),
+	                                                  json_thread_executor( 8 ) );
+	ensure( ints == std::vector<int>{ 1, 2, 3 } );
+
+#ifdef DAW_USE_EXCEPTIONS
+	// Both elements have a bad id, the first one must be reported
+	auto bad_doc = json_doc;
+	auto const first_bad = bad_doc.find( R"("id":1000,)" ) + 5;
+	auto const first_bad_element = bad_doc.rfind( '{', first_bad );
+	bad_doc[first_bad] = 'x';
+	bad_doc[bad_doc.find( R"("id":4000,)" ) + 5] = 'x';
+	bool has_error = false;
+	try {
+		(void)from_json_array_parallel<Element>( bad_doc,
+		                                         json_thread_executor( 4 ) );
+	} catch( json_exception const &jex ) {
+		has_error = true;
+		ensure( jex.parse_location( ) != nullptr );
+		ensure( jex.parse_location( ) >= bad_doc.data( ) + first_bad_element );
+		ensure( jex.parse_location( ) <
+		        bad_doc.data( ) + bad_doc.find( R"("id":1001,)" ) );
+	}
+	ensure( has_error );
+
+	// A missing separator between two elements far from the start
+	auto missing_comma = json_doc;
+	missing_comma[missing_comma.find( R"(},{"id":3000,)" ) + 1] = ' ';
+	has_error = false;
+	try {
+		(void)from_json_array_parallel<Element>( missing_comma,
+		                                         json_thread_executor( 4 ) );
+	} catch( json_exception const &jex ) {
+		has_error = true;
+		ensure( jex.parse_location( ) != nullptr );
+	}
+	ensure( has_error );
+#endif
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
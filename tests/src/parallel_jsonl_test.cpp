@@ -0,0 +1,133 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_parallel.h>
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct LogEntry {
+	std::size_t id;
+	std::string_view body;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<LogEntry> {
+		static constexpr char const id[] = "id";
+		static constexpr char const body[] = "body";
+		using type = json_member_list<json_link<id, std::size_t>,
+		                              json_link<body, std::string_view>>;
+	};
+} // namespace daw::json
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	// Skewed line sizes, a few lines are much longer than the rest
+	constexpr std::size_t line_count = 20000;
+	std::string jsonl_doc;
+	std::size_t expected_size = 0;
+	for( std::size_t n = 0; n < line_count; ++n ) {
+		auto const body_size = n % 1000 == 0 ? std::size_t{ 50000 } : n % 50;
+		expected_size += body_size;
+		jsonl_doc += R"({"id":)" + std::to_string( n ) + R"(,"body":")" +
+		             std::string( body_size, 'a' ) + "\"}\n";
+	}
+
+	auto const entries = parse_jsonl_parallel<LogEntry>( jsonl_doc );
+	ensure( entries.size( ) == line_count );
+	for( std::size_t n = 0; n < line_count; ++n ) {
+		ensure( entries[n].id == n );
+	}
+	auto const unchecked_entries =
+	  parse_jsonl_parallel<LogEntry, options::CheckedParseMode::no>(
+	    jsonl_doc, json_thread_executor( 3 ) );
+	ensure( unchecked_entries.size( ) == line_count );
+	ensure( unchecked_entries.back( ).id == line_count - 1 );
+
+	auto total_size = std::atomic<std::size_t>{ 0 };
+	auto line_total = std::atomic<std::size_t>{ 0 };
+	for_each_jsonl_parallel<LogEntry>(
+	  jsonl_doc,
+	  [&]( LogEntry const &entry ) {
+		  total_size += entry.body.size( );
+		  ++line_total;
+	  },
+	  json_thread_executor( 4 ) );
+	ensure( total_size == expected_size );
+	ensure( line_total == line_count );
+
+	auto const reduced_size = reduce_jsonl_parallel<LogEntry>(
+	  jsonl_doc, std::size_t{ 0 },
+	  []( std::size_t acc, LogEntry const &entry ) {
+		  return acc + entry.body.size( );
+	  },
+	  []( std::size_t lhs, std::size_t rhs ) {
+		  return lhs + rhs;
+	  } );
+	ensure( reduced_size == expected_size );
+
+	// init is combined once, whatever the number of chunks
+	for( std::size_t thread_count : { 1U, 3U, 8U } ) {
+		auto const offset_size = reduce_jsonl_parallel<LogEntry>(
+		  jsonl_doc, std::size_t{ 100 },
+		  []( std::size_t acc, LogEntry const &entry ) {
+			  return acc + entry.body.size( );
+		  },
+		  []( std::size_t lhs, std::size_t rhs ) {
+			  return lhs + rhs;
+		  },
+		  json_thread_executor( thread_count ) );
+		ensure( offset_size == expected_size + 100 );
+	}
+
+	ensure( parse_jsonl_parallel<LogEntry>( std::string_view( "" ) ).empty( ) );
+
+#ifdef DAW_USE_EXCEPTIONS
+	// Two bad lines, the first one must be reported
+	auto bad_doc = jsonl_doc;
+	auto const first_bad = bad_doc.find( R"({"id":3000,)" );
+	bad_doc[first_bad + 6] = 'x';
+	bad_doc[bad_doc.find( R"({"id":15000,)" ) + 6] = 'x';
+	bool has_error = false;
+	try {
+		(void)parse_jsonl_parallel<LogEntry>( bad_doc, json_thread_executor( 4 ) );
+	} catch( json_exception const &jex ) {
+		has_error = true;
+		ensure( jex.parse_location( ) >= bad_doc.data( ) + first_bad );
+		ensure( jex.parse_location( ) <
+		        bad_doc.data( ) + bad_doc.find( R"({"id":3001,)" ) );
+	}
+	ensure( has_error );
+#endif
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,167 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct Shape {
+	std::vector<std::vector<double>> coordinates;
+	std::vector<std::string> names;
+	std::vector<int> rgb;
+	std::unordered_map<std::string, int> counts;
+};
+
+struct Sized {
+	int size;
+	std::vector<int> values;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Shape> {
+		static constexpr char const coordinates[] = "coordinates";
+		static constexpr char const names[] = "names";
+		static constexpr char const rgb[] = "rgb";
+		static constexpr char const counts[] = "counts";
+		using type = json_member_list<
+		  json_array<coordinates, std::vector<double>>,
+		  json_array<names, std::string, std::vector<std::string>,
+		             presized_constructor<std::vector<std::string>>>,
+		  json_array<rgb, int, std::vector<int>,
+		             presized_constructor<std::vector<int>, 3>>,
+		  json_key_value<
+		    counts, std::unordered_map<std::string, int>, int, std::string,
+		    presized_constructor<std::unordered_map<std::string, int>>>>;
+	};
+
+	template<>
+	struct json_data_contract<Sized> {
+		static constexpr char const size[] = "size";
+		static constexpr char const values[] = "values";
+		using type =
+		  json_member_list<json_link<size, int>,
+		                   json_sized_array<values, int, json_link<size, int>>>;
+	};
+} // namespace daw::json
+
+std::string make_coordinates( std::size_t count ) {
+	std::string result = "[";
+	for( std::size_t n = 0; n < count; ++n ) {
+		if( n > 0 ) {
+			result += ",";
+		}
+		result += "[" + std::to_string( n ) + ".5, -" + std::to_string( n ) + "]";
+	}
+	result += "]";
+	return result;
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	std::string const json_doc =
+	  R"json({
+	"coordinates": )json" +
+	  make_coordinates( 1000 ) + R"json(,
+	"names": [ "a,b", "[c]", "{\"d\",", "" ],
+	"rgb": [ 1, 2, 3 ],
+	"counts": { "x,": 1, "y}": 2, "z": 3 }
+})json";
+
+	{
+		auto const s = from_json<Shape>( json_doc );
+		ensure( s.coordinates.size( ) == 1000 );
+		ensure( s.names.size( ) == 4 );
+		// Only the per member constructors size their containers
+		ensure( s.names.capacity( ) == 4 );
+		ensure( s.rgb.capacity( ) == 3 );
+		ensure( s.counts.size( ) == 3 );
+		ensure( s.counts.at( "y}" ) == 2 );
+	}
+	{
+		auto const s = from_json<Shape>(
+		  json_doc, options::parse_flags<options::PresizeArrays::yes> );
+		ensure( s.coordinates.size( ) == 1000 );
+		ensure( s.coordinates.capacity( ) == 1000 );
+		ensure( s.coordinates[999].size( ) == 2 );
+		ensure( s.coordinates[999].capacity( ) == 2 );
+		ensure( s.coordinates[999][0] == 999.5 );
+		ensure( s.names[2] == "{\"d\"," );
+		ensure( s.names.capacity( ) == 4 );
+		ensure( s.rgb == std::vector<int>{ 1, 2, 3 } );
+		ensure( s.counts.at( "x," ) == 1 );
+	}
+	{
+		auto const v = from_json<std::vector<int>>(
+		  "[ ]", options::parse_flags<options::PresizeArrays::yes> );
+		ensure( v.empty( ) );
+		auto const v2 = from_json<std::vector<std::vector<int>>>(
+		  " [ [], [ 1 ], [ 2, 3 ] ] ",
+		  options::parse_flags<options::PresizeArrays::yes> );
+		ensure( v2.size( ) == 3 and v2.capacity( ) == 3 );
+		ensure( v2[0].empty( ) and v2[2].capacity( ) == 2 );
+	}
+	{
+		auto const s = from_json<Sized>( R"json({"size":4,"values":[1,2,3,4]})json" );
+		ensure( s.values.size( ) == 4 );
+		ensure( s.values.capacity( ) == 4 );
+		// The size from the document is limited by what the data can hold
+		auto const big =
+		  from_json<Sized>( R"json({"size":2000000000,"values":[1,2]})json" );
+		ensure( big.values.size( ) == 2 );
+		ensure( big.values.capacity( ) < 16 );
+	}
+#ifdef DAW_USE_EXCEPTIONS
+	{
+		bool has_error = false;
+		try {
+			(void)from_json<Sized>( R"json({"size":-1,"values":[1]})json" );
+		} catch( json_exception const &jex ) {
+			has_error = jex.reason_type( ) == ErrorReason::NumberOutOfRange;
+		}
+		ensure( has_error );
+	}
+	{
+		// The document ends inside an escape while the array is being counted
+		bool has_error = false;
+		try {
+			(void)from_json<std::vector<std::string>>(
+			  std::string_view( R"json(["a\)json" ),
+			  options::parse_flags<options::PresizeArrays::yes,
+			                       options::ExecModeTypes::compile_time> );
+		} catch( json_exception const &jex ) {
+			has_error = jex.reason_type( ) == ErrorReason::UnexpectedEndOfData;
+		}
+		ensure( has_error );
+	}
+#endif
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,102 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct Frame {
+	std::string name;
+	std::vector<double> values;
+	std::optional<std::int64_t> id;
+	std::map<std::string, bool> flags;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Frame> {
+		static constexpr char const name[] = "name";
+		static constexpr char const values[] = "values";
+		static constexpr char const id[] = "id";
+		static constexpr char const flags[] = "flags";
+		using type = json_member_list<
+		  json_string<name>, json_array<values, double>,
+		  json_number_null<id, std::optional<std::int64_t>>,
+		  json_key_value<flags, std::map<std::string, bool>, bool>>;
+
+		static auto to_json_data( Frame const &v ) {
+			return std::forward_as_tuple( v.name, v.values, v.id, v.flags );
+		}
+	};
+} // namespace daw::json
+
+template<typename T, typename Flags>
+void check_size( T const &value, Flags flags ) {
+	auto const json_doc = daw::json::to_json( value, flags );
+	ensure( daw::json::json_serialized_size( value, flags ) == json_doc.size( ) );
+	ensure( daw::json::to_json_presized( value, flags ) == json_doc );
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	auto const frames = std::vector<Frame>{
+	  Frame{ "plain", { 1.0, -0.5, 1e300, 3.14159 }, 42, { { "a", true } } },
+	  Frame{ "esc\"aped\\\n\t\x01 caf\xC3\xA9 \xF0\x9F\x98\x8D",
+	         { },
+	         std::nullopt,
+	         { { "b\"", false }, { "c", true } } },
+	  Frame{ "", { 5e-324, 123456789.125 }, -9223372036854775807LL, { } } };
+
+	for( auto const &f : frames ) {
+		check_size( f, options::output_flags<> );
+		check_size( f, options::output_flags<options::SerializationFormat::Pretty> );
+		check_size(
+		  f, options::output_flags<
+		       options::SerializationFormat::Pretty,
+		       options::IndentationType::Tab, options::NewLineDelimiter::rn> );
+		check_size(
+		  f, options::output_flags<
+		       options::RestrictedStringOutput::OnlyAllow7bitsStrings> );
+	}
+	check_size( std::string( "\"\\\b\f" ), options::output_flags<> );
+	check_size( 1234567, options::output_flags<> );
+
+	auto const json_array = to_json_array( frames );
+	ensure( json_serialized_array_size( frames ) == json_array.size( ) );
+	ensure( to_json_array_presized( frames ) == json_array );
+	ensure( json_serialized_array_size( std::vector<int>{ } ) == 2 );
+	auto const pretty = options::output_flags<options::SerializationFormat::Pretty>;
+	ensure( json_serialized_array_size( frames, pretty ) ==
+	        to_json_array( frames, pretty ).size( ) );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,74 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_value_state.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr std::size_t key_count = 3000;
+	auto json_doc = std::string( "{" );
+	for( std::size_t n = 0; n < key_count; ++n ) {
+		json_doc += "\"flag_" + std::to_string( n ) + "\":" + std::to_string( n ) +
+		            ",";
+	}
+	// A duplicate name finds the first member
+	json_doc += R"("flag_7":-1})";
+
+	auto state = json_value_state( json_doc );
+	// Out of order lookups, before and after the whole class has been seen
+	ensure( state["flag_2000"].as<int>( ) == 2000 );
+	ensure( state.index_of( "flag_10" ) == 10 );
+	ensure( state.contains( "flag_2999" ) );
+	ensure( not state.contains( "flag_3000" ) );
+	ensure( state.size( ) == key_count + 1 );
+	for( std::size_t n = 0; n < key_count; n += 7 ) {
+		auto const name = "flag_" + std::to_string( n );
+		ensure( state.index_of( name ) == n );
+		ensure( state[name].as<std::size_t>( ) == n );
+		ensure( state[n].as<std::size_t>( ) == n );
+	}
+	ensure( state["flag_7"].as<int>( ) == 7 );
+	ensure( state[-1].as<int>( ) == -1 );
+	ensure( state.index_of( "missing" ) == key_count + 1 );
+	ensure( not state.at( "missing" ) );
+
+	// Reusing the state for a small class and an array
+	state.reset( basic_json_value( R"({"a":1,"b":2})" ) );
+	ensure( state.size( ) == 2 );
+	ensure( state["b"].as<int>( ) == 2 );
+	ensure( not state.contains( "flag_1" ) );
+	state.reset( basic_json_value( "[5,6,7]" ) );
+	ensure( state.size( ) == 3 );
+	ensure( state[2].as<int>( ) == 7 );
+	ensure( not state.contains( 3 ) );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
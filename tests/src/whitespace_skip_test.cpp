@@ -0,0 +1,156 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Whitespace runs of every length around the vector widths, for the whitespace
+// kernels and for trim_left in each comment policy and exec mode.  Buffers are
+// sized exactly so that reading past last is caught by the sanitizers
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/impl/daw_json_cpu_features.h>
+#include <daw/json/impl/daw_json_string_util.h>
+
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+static constexpr std::size_t run_lengths[] = { 0,  1,  2,  3,  7,  15, 16, 17,
+                                               31, 32, 33, 47, 63, 64, 65, 130 };
+
+static std::string make_whitespace( std::size_t len ) {
+	constexpr char const pattern[] = " \t\n \r  ";
+	auto result = std::string( );
+	for( std::size_t n = 0; n < len; ++n ) {
+		result += pattern[n % ( sizeof( pattern ) - 1U )];
+	}
+	return result;
+}
+
+static std::unique_ptr<char[]> exact_copy( std::string const &str ) {
+	auto result = std::make_unique<char[]>( str.size( ) );
+	std::memcpy( result.get( ), str.data( ), str.size( ) );
+	return result;
+}
+
+template<typename ExecTag>
+void check_kernel( ) {
+	using daw::json::json_details::mem_skip_whitespace_run;
+	for( std::size_t len : run_lengths ) {
+		auto const ws = make_whitespace( len );
+		// Runs followed by tails shorter and longer than the vector width
+		for( std::size_t tail = 1; tail <= 33; ++tail ) {
+			auto const doc = ws + std::string( tail, 'x' );
+			auto const buf = exact_copy( doc );
+			ensure( mem_skip_whitespace_run<ExecTag>(
+			          buf.get( ), buf.get( ) + doc.size( ) ) == buf.get( ) + len );
+		}
+		// Runs that end exactly at last, from every starting offset
+		auto const buf = exact_copy( ws );
+		for( std::size_t offset = 0; offset <= len; ++offset ) {
+			ensure( mem_skip_whitespace_run<ExecTag>( buf.get( ) + offset,
+			                                          buf.get( ) + len ) ==
+			        buf.get( ) + len );
+		}
+	}
+}
+
+template<daw::json::options::ExecModeTypes ExecMode>
+void check_policies( ) {
+	using namespace daw::json;
+	auto const expected = std::vector<int>{ 1, 2, 3 };
+	for( std::size_t len : run_lengths ) {
+		auto const ws = make_whitespace( len );
+
+		// The last run ends exactly at the end of the document
+		auto const doc =
+		  ws + "[" + ws + "1" + ws + "," + ws + "2," + ws + "3" + ws + "]" + ws;
+		ensure( from_json<std::vector<int>>(
+		          doc, options::parse_flags<ExecMode> ) == expected );
+		ensure( from_json<std::vector<int>>(
+		          doc, options::parse_flags<ExecMode,
+		                                    options::CheckedParseMode::no> ) ==
+		        expected );
+		ensure( from_json<std::vector<int>>(
+		          doc,
+		          options::parse_flags<ExecMode,
+		                               options::MustVerifyEndOfDataIsValid::yes> ) ==
+		        expected );
+
+		auto const cpp_doc = ws + "/* a */" + ws + "[" + ws + "// b\n" + ws + "1" +
+		                     ws + "/**/," + ws + "2/* c */" + ws + ",// d\n" + ws +
+		                     "3" + ws + "]" + ws + "// e\n" + ws;
+		ensure( from_json<std::vector<int>>(
+		          cpp_doc,
+		          options::parse_flags<ExecMode, options::PolicyCommentTypes::cpp> ) ==
+		        expected );
+		ensure( from_json<std::vector<int>>(
+		          cpp_doc,
+		          options::parse_flags<ExecMode, options::PolicyCommentTypes::cpp,
+		                               options::CheckedParseMode::no> ) ==
+		        expected );
+
+		auto const hash_doc = ws + "# a\n" + ws + "[" + ws + "# b\n" + ws + "1" +
+		                      ws + "," + ws + "#\n2," + ws + "3" + ws + "# c\n" +
+		                      ws + "]" + ws + "# d\n" + ws;
+		ensure( from_json<std::vector<int>>(
+		          hash_doc, options::parse_flags<
+		                      ExecMode, options::PolicyCommentTypes::hash> ) ==
+		        expected );
+		ensure( from_json<std::vector<int>>(
+		          hash_doc,
+		          options::parse_flags<ExecMode, options::PolicyCommentTypes::hash,
+		                               options::CheckedParseMode::no> ) ==
+		        expected );
+	}
+}
+
+int main( )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	check_policies<options::ExecModeTypes::compile_time>( );
+	check_policies<options::ExecModeTypes::runtime>( );
+
+	auto const &features = host_cpu_features( );
+	(void)features;
+#if defined( DAW_ALLOW_SSE42 )
+	if( features.sse42 and features.pclmul ) {
+		check_kernel<sse42_exec_tag>( );
+		check_policies<options::ExecModeTypes::simd>( );
+	} else {
+		std::cout << "Skipping the sse4.2 exec mode, the host does not support it\n";
+	}
+#endif
+#if defined( DAW_ALLOW_AVX2 )
+	if( features.avx2 and features.bmi1 ) {
+		check_kernel<avx2_exec_tag>( );
+		check_policies<options::ExecModeTypes::avx2>( );
+	} else {
+		std::cout << "Skipping the avx2 exec mode, the host does not support it\n";
+	}
+#endif
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif